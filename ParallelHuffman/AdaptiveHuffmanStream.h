@@ -0,0 +1,509 @@
+/**
+ * @file : AdaptiveHuffmanStream.h
+ * @author : Edwin Kaburu
+ * @date : 10/18/2026
+ *
+ * One-pass Huffman Streaming. Data is encoded as it arrives, in blocks of bounded size, with the codebook
+ * re-derived from running counts every interval and signalled in the stream whenever it changes.
+ *
+ * Stream Layout (integers little endian):
+ *      "HFS1" | u8 stream flags | [u8 K | K x 256 u8 code lengths, when STREAM_SHARED_CODEBOOKS]
+ *      block:  u8 block flags | [256 u8 code lengths, when BLOCK_NEW_CODEBOOK]
+ *              | [u8 shared codebook id, when BLOCK_SHARED_CODEBOOK] | u32 raw size | u32 payload size
+ *              | [u32 CRC32C of the raw bytes, when STREAM_BLOCK_CHECKSUMS] | payload
+ *      end:    u8 BLOCK_END
+ */
+#ifndef EKHUFFMANPROJECT_ADAPTIVEHUFFMANSTREAM_H
+#define EKHUFFMANPROJECT_ADAPTIVEHUFFMANSTREAM_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "HuffmanCodebook.h"
+
+using namespace std;
+
+// Stream Magic Identifier
+const char STREAM_MAGIC[4] = {'H', 'F', 'S', '1'};
+// Every block carries a CRC32C of its raw bytes
+const uint8_t STREAM_BLOCK_CHECKSUMS = 0x01;
+// The header carries codebooks that blocks select by id
+const uint8_t STREAM_SHARED_CODEBOOKS = 0x02;
+// Block carries a new codebook ahead of its payload
+const uint8_t BLOCK_NEW_CODEBOOK = 0x01;
+// Marks the end of the stream
+const uint8_t BLOCK_END = 0x02;
+// Block selects one of the shared codebooks ahead of its payload
+const uint8_t BLOCK_SHARED_CODEBOOK = 0x04;
+// Default Rebuild Interval, in bytes
+const size_t DEFAULT_REBUILD_INTERVAL = 64 * 1024;
+// Largest block any encoder writes, decoders reject bigger sizes before allocating anything
+const size_t MAX_STREAM_BLOCK = 64 * 1024 * 1024;
+// A payload is read this much at a time, so a header claiming more than the input holds allocates little
+const size_t PAYLOAD_READ_CHUNK = 1024 * 1024;
+// Running Counts are halved once their total passes this value, so old data fades out
+const uint64_t COUNT_AGING_LIMIT = uint64_t(1) << 24;
+
+/**
+ * WriteUnsigned32() Append a little endian 32 bit value
+ * @param output String Output
+ * @param value Unsigned Integer
+ */
+static void WriteUnsigned32(string &output, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        output.push_back(char((value >> (8 * i)) & 0xFF));
+    }
+}
+
+/**
+ * ReadUnsigned32() Read a little endian 32 bit value
+ * @param input Input Stream
+ * @param value Unsigned Integer Output
+ * @return Boolean Condition, false on end of input
+ */
+static bool ReadUnsigned32(istream &input, uint32_t &value) {
+    unsigned char bytes[4];
+    if (!input.read(reinterpret_cast<char *>(bytes), 4)) {
+        return false;
+    }
+    value = uint32_t(bytes[0]) | (uint32_t(bytes[1]) << 8) | (uint32_t(bytes[2]) << 16) | (uint32_t(bytes[3]) << 24);
+    return true;
+}
+
+/**
+ * AppendStreamHeader() Append the stream magic and flags
+ * @param output String Output
+ * @param checksums Boolean Condition, every block of the stream will carry a checksum
+ */
+static void AppendStreamHeader(string &output, bool checksums = false) {
+    output.append(STREAM_MAGIC, 4);
+    output.push_back(char(checksums ? STREAM_BLOCK_CHECKSUMS : 0));
+}
+
+/**
+ * PatchUnsigned32() Overwrite four bytes of output with a little endian 32 bit value
+ * @param output String Output
+ * @param at Position of the first Byte
+ * @param value Unsigned Integer
+ */
+static void PatchUnsigned32(string &output, size_t at, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        output[at + i] = char((value >> (8 * i)) & 0xFF);
+    }
+}
+
+/**
+ * AppendSharedStreamHeader() Append the stream magic and flags followed by the shared codebooks
+ * @param output String Output
+ * @param codebooks vector<HuffmanCodebook>, between 1 and 255 non-empty codebooks
+ * @param checksums Boolean Condition, every block of the stream will carry a checksum
+ */
+static void AppendSharedStreamHeader(string &output, const vector<HuffmanCodebook> &codebooks,
+                                     bool checksums = false) {
+    output.append(STREAM_MAGIC, 4);
+    output.push_back(char(STREAM_SHARED_CODEBOOKS | (checksums ? STREAM_BLOCK_CHECKSUMS : 0)));
+    output.push_back(char(codebooks.size()));
+    for (const HuffmanCodebook &codebook: codebooks) {
+        output.append(reinterpret_cast<const char *>(codebook.Lengths()), SYMBOL_COUNT);
+    }
+}
+
+/**
+ * AppendStreamEnd() Append the end of stream marker
+ * @param output String Output
+ */
+static void AppendStreamEnd(string &output) {
+    output.push_back(char(BLOCK_END));
+}
+
+/**
+ * AppendBlockPayload() Append the sizes, checksum and payload of a block whose flags are already written
+ * @param codebook HuffmanCodebook with a codeword for every byte of data
+ * @param data Byte Pointer
+ * @param size Number of Bytes
+ * @param output String Output
+ * @param checksum Boolean Condition, the stream header asked for block checksums
+ */
+static void AppendBlockPayload(const HuffmanCodebook &codebook, const unsigned char *data, size_t size,
+                               string &output, bool checksum) {
+    WriteUnsigned32(output, uint32_t(size));
+    size_t sizeAt = output.size();
+    WriteUnsigned32(output, 0);
+    if (checksum) {
+        WriteUnsigned32(output, 0);
+    }
+    // The checksum is taken by the encoder while each slice of data is in cache
+    uint32_t crc = 0;
+    size_t payloadSize = codebook.EncodeBlock(data, size, output, checksum ? &crc : nullptr);
+    // Patch in the payload size and checksum
+    PatchUnsigned32(output, sizeAt, uint32_t(payloadSize));
+    if (checksum) {
+        PatchUnsigned32(output, sizeAt + 4, crc);
+    }
+}
+
+/**
+ * AppendStreamBlock() Encode data as one stream block and append it to output
+ * @param codebook HuffmanCodebook with a codeword for every byte of data
+ * @param sendCodebook Boolean Condition, write the code lengths ahead of the payload
+ * @param data Byte Pointer
+ * @param size Number of Bytes
+ * @param output String Output
+ * @param checksum Boolean Condition, the stream header asked for block checksums
+ */
+static void AppendStreamBlock(const HuffmanCodebook &codebook, bool sendCodebook, const unsigned char *data,
+                              size_t size, string &output, bool checksum = false) {
+    output.push_back(char(sendCodebook ? BLOCK_NEW_CODEBOOK : 0));
+    if (sendCodebook) {
+        output.append(reinterpret_cast<const char *>(codebook.Lengths()), SYMBOL_COUNT);
+    }
+    AppendBlockPayload(codebook, data, size, output, checksum);
+}
+
+/**
+ * AppendSharedBlock() Encode data with one of the shared codebooks as one stream block, storing only its id
+ * @param codebook HuffmanCodebook, shared codebook number codebookId, with a codeword for every byte of data
+ * @param codebookId Shared Codebook Index
+ * @param data Byte Pointer
+ * @param size Number of Bytes
+ * @param output String Output
+ * @param checksum Boolean Condition, the stream header asked for block checksums
+ */
+static void AppendSharedBlock(const HuffmanCodebook &codebook, uint8_t codebookId, const unsigned char *data,
+                              size_t size, string &output, bool checksum = false) {
+    output.push_back(char(BLOCK_SHARED_CODEBOOK));
+    output.push_back(char(codebookId));
+    AppendBlockPayload(codebook, data, size, output, checksum);
+}
+
+/**
+ * AppendStandaloneBlock() Encode data with a codebook built from its own counts, as one stream block
+ * @param data Byte Pointer
+ * @param size Number of Bytes
+ * @param output String Output
+ * @param checksum Boolean Condition, the stream header asked for block checksums
+ */
+static void AppendStandaloneBlock(const unsigned char *data, size_t size, string &output, bool checksum = false) {
+    uint64_t counts[SYMBOL_COUNT];
+    HuffmanTreeBuilder::CountHistogram(data, size, counts, size);
+    HuffmanCodebook codebook;
+    bool hasSymbols = codebook.BuildFromCounts(counts);
+    AppendStreamBlock(codebook, hasSymbols, data, size, output, checksum);
+}
+
+/**
+ * @class HuffmanStreamEncoder . Encodes an unbounded input with bounded memory and latency.
+ */
+class HuffmanStreamEncoder {
+public:
+    /**
+     * HuffmanStreamEncoder() Constructor To Create Instance of HuffmanStreamEncoder
+     * @param output Output Stream, receives the encoded stream
+     * @param rebuildInterval Number of Bytes between codebook rebuilds, also the largest block
+     * @param checksums Boolean Condition, give every block a CRC32C
+     */
+    HuffmanStreamEncoder(ostream &output, size_t rebuildInterval = DEFAULT_REBUILD_INTERVAL, bool checksums = false)
+            : OUTPUT(output),
+              INTERVAL(rebuildInterval > 0 ? min(rebuildInterval, MAX_STREAM_BLOCK) : DEFAULT_REBUILD_INTERVAL),
+              CHECKSUMS(checksums) {
+        memset(RUNNING_COUNTS, 0, sizeof(RUNNING_COUNTS));
+        PENDING.reserve(INTERVAL);
+        string header;
+        AppendStreamHeader(header, CHECKSUMS);
+        OUTPUT.write(header.data(), header.size());
+    }
+
+    /**
+     * Write() Feed data into the stream, full blocks are emitted right away
+     * @param data Character Pointer
+     * @param size Number of Bytes
+     */
+    void Write(const char *data, size_t size) {
+        while (size > 0) {
+            size_t take = min(size, INTERVAL - PENDING.size());
+            PENDING.append(data, take);
+            data += take;
+            size -= take;
+            if (PENDING.size() == INTERVAL) {
+                EmitBlock();
+            }
+        }
+    }
+
+    /**
+     * Flush() Emit the pending partial block, bounding the latency of slow inputs
+     */
+    void Flush() {
+        if (!PENDING.empty()) {
+            EmitBlock();
+        }
+        OUTPUT.flush();
+    }
+
+    /**
+     * Finish() Flush and terminate the stream
+     */
+    void Finish() {
+        if (!FINISHED) {
+            Flush();
+            string end;
+            AppendStreamEnd(end);
+            OUTPUT.write(end.data(), end.size());
+            OUTPUT.flush();
+            FINISHED = true;
+        }
+    }
+
+    /**
+     * NumCodebookChanges() Number of codebooks signalled in the stream so far
+     * @return Integer Count
+     */
+    int NumCodebookChanges() const {
+        return NUM_CHANGES;
+    }
+
+    /**
+     * ~HuffmanStreamEncoder() Destructor, terminates the stream if needed
+     */
+    ~HuffmanStreamEncoder() {
+        Finish();
+    }
+
+private:
+    // Destination Stream
+    ostream &OUTPUT;
+    // Rebuild Interval and Maximum Block Size
+    size_t INTERVAL;
+    // Blocks carry a CRC32C
+    bool CHECKSUMS;
+    // Data Waiting for the next Block
+    string PENDING;
+    // Encoded Block Scratch
+    string BLOCK;
+    // Running Counts over the Stream
+    uint64_t RUNNING_COUNTS[SYMBOL_COUNT];
+    // Running Counts Total
+    uint64_t RUNNING_TOTAL = 0;
+    // Bytes Encoded since the last Rebuild
+    size_t SINCE_REBUILD = 0;
+    // Active Codebook
+    HuffmanCodebook CODEBOOK;
+    // Number of Codebooks Signalled
+    int NUM_CHANGES = 0;
+    // Stream Terminated
+    bool FINISHED = false;
+
+    /**
+     * EmitBlock() Encode PENDING as one block, rebuilding the codebook when due
+     */
+    void EmitBlock() {
+        const unsigned char *data = reinterpret_cast<const unsigned char *>(PENDING.data());
+        uint64_t blockCounts[SYMBOL_COUNT];
+        HuffmanTreeBuilder::CountHistogram(data, PENDING.size(), blockCounts, PENDING.size());
+        for (int s = 0; s < SYMBOL_COUNT; s++) {
+            RUNNING_COUNTS[s] += blockCounts[s];
+        }
+        RUNNING_TOTAL += PENDING.size();
+        SINCE_REBUILD += PENDING.size();
+
+        // Rebuild every interval, or sooner when this block holds a symbol without a codeword
+        bool sendCodebook = false;
+        if (CODEBOOK.IsEmpty() || SINCE_REBUILD >= INTERVAL || !CODEBOOK.CanEncode(blockCounts)) {
+            HuffmanCodebook rebuilt;
+            rebuilt.BuildFromCounts(RUNNING_COUNTS);
+            if (CODEBOOK.IsEmpty() || memcmp(rebuilt.Lengths(), CODEBOOK.Lengths(), SYMBOL_COUNT) != 0) {
+                CODEBOOK = rebuilt;
+                sendCodebook = true;
+                NUM_CHANGES++;
+            }
+            SINCE_REBUILD = 0;
+            AgeCounts();
+        }
+
+        BLOCK.clear();
+        AppendStreamBlock(CODEBOOK, sendCodebook, data, PENDING.size(), BLOCK, CHECKSUMS);
+        OUTPUT.write(BLOCK.data(), BLOCK.size());
+        PENDING.clear();
+    }
+
+    /**
+     * AgeCounts() Halve running counts once they grow past COUNT_AGING_LIMIT
+     */
+    void AgeCounts() {
+        if (RUNNING_TOTAL > COUNT_AGING_LIMIT) {
+            RUNNING_TOTAL = 0;
+            for (int s = 0; s < SYMBOL_COUNT; s++) {
+                RUNNING_COUNTS[s] = (RUNNING_COUNTS[s] + 1) / 2;
+                RUNNING_TOTAL += RUNNING_COUNTS[s];
+            }
+        }
+    }
+};
+
+/**
+ * @class HuffmanStreamDecoder . Decodes a stream written by HuffmanStreamEncoder, one block at a time.
+ */
+class HuffmanStreamDecoder {
+public:
+    /**
+     * HuffmanStreamDecoder() Constructor To Create Instance of HuffmanStreamDecoder
+     * @param input Input Stream, positioned at the stream magic
+     */
+    explicit HuffmanStreamDecoder(istream &input) : INPUT(input) {
+        char magic[4];
+        if (INPUT.read(magic, 4) && memcmp(magic, STREAM_MAGIC, 4) == 0) {
+            int flags = INPUT.get();
+            VALID = flags != EOF && (flags & ~(STREAM_BLOCK_CHECKSUMS | STREAM_SHARED_CODEBOOKS)) == 0;
+            CHECKSUMS = VALID && (flags & STREAM_BLOCK_CHECKSUMS);
+            if (VALID && (flags & STREAM_SHARED_CODEBOOKS)) {
+                VALID = ReadSharedCodebooks();
+            }
+        }
+    }
+
+    /**
+     * DecodeNext() Decode the next block
+     * @param output String Output, replaced by the block contents
+     * @return Boolean Condition, false at the end of the stream or on corrupt data
+     */
+    bool DecodeNext(string &output) {
+        output.clear();
+        if (!VALID || ENDED) {
+            return false;
+        }
+        int flags = INPUT.get();
+        if (flags == EOF) {
+            return Fail();
+        }
+        if (flags & BLOCK_END) {
+            ENDED = true;
+            return false;
+        }
+        if (flags & BLOCK_NEW_CODEBOOK) {
+            uint8_t lengths[SYMBOL_COUNT];
+            if (!INPUT.read(reinterpret_cast<char *>(lengths), SYMBOL_COUNT) || !CODEBOOK.SetLengths(lengths)) {
+                return Fail();
+            }
+            ACTIVE_SHARED = -1;
+        }
+        if (flags & BLOCK_SHARED_CODEBOOK) {
+            // The shared tables were built once from the header, selecting one costs nothing
+            int codebookId = INPUT.get();
+            if (codebookId == EOF || codebookId >= int(SHARED.size())) {
+                return Fail();
+            }
+            ACTIVE_SHARED = codebookId;
+        }
+        const HuffmanCodebook &codebook = ACTIVE_SHARED < 0 ? CODEBOOK : SHARED[ACTIVE_SHARED];
+
+        uint32_t rawSize = 0, payloadSize = 0, expected = 0;
+        if (!ReadUnsigned32(INPUT, rawSize) || !ReadUnsigned32(INPUT, payloadSize) ||
+            (CHECKSUMS && !ReadUnsigned32(INPUT, expected))) {
+            return Fail();
+        }
+        // Codewords are at most MAX_CODE_LENGTH bits, so a bigger payload cannot belong to rawSize bytes
+        if (rawSize > MAX_STREAM_BLOCK || payloadSize > (uint64_t(rawSize) * MAX_CODE_LENGTH + 7) / 8) {
+            return Fail();
+        }
+        PAYLOAD.clear();
+        while (PAYLOAD.size() < payloadSize) {
+            size_t have = PAYLOAD.size();
+            size_t take = min(PAYLOAD_READ_CHUNK, payloadSize - have);
+            PAYLOAD.resize(have + take);
+            if (!INPUT.read(&PAYLOAD[have], take)) {
+                return Fail();
+            }
+        }
+        // The checksum is taken by the decoder while each slice of output is in cache
+        uint32_t actual = 0;
+        if (!codebook.DecodeBlock(reinterpret_cast<const unsigned char *>(PAYLOAD.data()), payloadSize, rawSize,
+                                  output, CHECKSUMS ? &actual : nullptr)) {
+            return Fail();
+        }
+        if (CHECKSUMS && actual != expected) {
+            output.clear();
+            CHECKSUM_MISMATCH = true;
+            return Fail();
+        }
+        return true;
+    }
+
+    /**
+     * DecodeAll() Decode every remaining block into output
+     * @param output Output Stream
+     * @return Boolean Condition, true when the stream ended cleanly
+     */
+    bool DecodeAll(ostream &output) {
+        string block;
+        while (DecodeNext(block)) {
+            output.write(block.data(), block.size());
+        }
+        return VALID && ENDED;
+    }
+
+    /**
+     * IsValid() Check if no corruption has been detected
+     * @return Boolean Condition
+     */
+    bool IsValid() const {
+        return VALID;
+    }
+
+    /**
+     * HasChecksumMismatch() Check if a block decoded to bytes whose CRC32C differs from the one stored with it
+     * @return Boolean Condition
+     */
+    bool HasChecksumMismatch() const {
+        return CHECKSUM_MISMATCH;
+    }
+
+private:
+    // Source Stream
+    istream &INPUT;
+    // Codebook last sent in the stream
+    HuffmanCodebook CODEBOOK;
+    // Codebooks from the stream header
+    vector<HuffmanCodebook> SHARED;
+    // Shared Codebook in use, -1 for CODEBOOK
+    int ACTIVE_SHARED = -1;
+    // Payload Scratch
+    string PAYLOAD;
+    // Stream Header Accepted and no Corruption Seen
+    bool VALID = false;
+    // End Marker Reached
+    bool ENDED = false;
+    // Blocks carry a CRC32C
+    bool CHECKSUMS = false;
+    // A Block failed its CRC32C
+    bool CHECKSUM_MISMATCH = false;
+
+    /**
+     * ReadSharedCodebooks() Read the shared codebooks following the stream flags
+     * @return Boolean Condition, false on corrupt data
+     */
+    bool ReadSharedCodebooks() {
+        int count = INPUT.get();
+        if (count == EOF || count == 0) {
+            return false;
+        }
+        SHARED.resize(count);
+        for (HuffmanCodebook &codebook: SHARED) {
+            uint8_t lengths[SYMBOL_COUNT];
+            if (!INPUT.read(reinterpret_cast<char *>(lengths), SYMBOL_COUNT) || !codebook.SetLengths(lengths)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Fail() Mark the stream corrupt
+     * @return Boolean Condition, always false
+     */
+    bool Fail() {
+        VALID = false;
+        return false;
+    }
+};
+
+#endif //EKHUFFMANPROJECT_ADAPTIVEHUFFMANSTREAM_H
@@ -0,0 +1,414 @@
+/**
+ * @file : AsyncBlockCompressor.h
+ * @author : Edwin Kaburu
+ * @date : 10/18/2026
+ *
+ * Compress many files with overlapped I/O. Input blocks are read through an AsyncIOBackend, Huffman encoded by
+ * a fixed pool of encoder threads, and written back in order, keeping several blocks of every stage in flight.
+ * Output files use the AdaptiveHuffmanStream layout and decode with HuffmanStreamDecoder.
+ */
+#ifndef EKHUFFMANPROJECT_ASYNCBLOCKCOMPRESSOR_H
+#define EKHUFFMANPROJECT_ASYNCBLOCKCOMPRESSOR_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <thread>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include "AsyncFileIO.h"
+#include "AdaptiveHuffmanStream.h"
+
+using namespace std;
+
+// Default Size of an Input Block
+const size_t DEFAULT_COMPRESS_BLOCK = 1024 * 1024;
+// Default Number of Blocks in Flight
+const unsigned DEFAULT_QUEUE_DEPTH = 16;
+// Suffix of Compressed Files
+const string COMPRESSED_SUFFIX = ".hfs";
+
+/**
+ * @struct Totals reported after a compression run
+ */
+struct CompressionSummary {
+    int filesDone = 0; // Files Compressed
+    int filesFailed = 0; // Files with an I/O Error
+    uint64_t bytesIn = 0; // Input Bytes
+    uint64_t bytesOut = 0; // Output Bytes
+    double seconds = 0; // Wall Time
+    string backend; // I/O Backend Name
+    string checksum; // CRC32C Implementation, empty when blocks carry no checksum
+};
+
+/**
+ * @class AsyncBlockCompressor . Pipelined read, encode, write of many files.
+ */
+class AsyncBlockCompressor {
+public:
+    /**
+     * AsyncBlockCompressor() Constructor To Create Instance of AsyncBlockCompressor
+     * @param blockSize Number of Bytes per Input Block
+     * @param queueDepth Number of Blocks in Flight across all files
+     * @param preferThreads Boolean Condition, use the thread backend even where io_uring works
+     * @param checksums Boolean Condition, give every block a CRC32C, taken by its encoder
+     */
+    AsyncBlockCompressor(size_t blockSize = DEFAULT_COMPRESS_BLOCK, unsigned queueDepth = DEFAULT_QUEUE_DEPTH,
+                         bool preferThreads = false, bool checksums = false)
+            : INPUT_BLOCK(blockSize > 0 ? min(blockSize, MAX_STREAM_BLOCK) : DEFAULT_COMPRESS_BLOCK),
+              DEPTH(queueDepth > 0 ? queueDepth : DEFAULT_QUEUE_DEPTH),
+              BACKEND(CreateIOBackend(DEPTH, preferThreads)), CHECKSUMS(checksums) {
+
+    }
+
+    /**
+     * CompressFiles() Compress every path into path + COMPRESSED_SUFFIX
+     * @param paths vector<string> Input Paths
+     * @return CompressionSummary
+     */
+    CompressionSummary CompressFiles(const vector<string> &paths) {
+        chrono::steady_clock::time_point started = chrono::steady_clock::now();
+        SUMMARY = CompressionSummary();
+        SUMMARY.backend = BACKEND->Name();
+        SUMMARY.checksum = CHECKSUMS ? Crc32cBackend() : "";
+
+        JOBS.clear();
+        STOPPING = false;
+        vector<thread> encoders;
+        for (unsigned i = 0; i < max(1u, thread::hardware_concurrency()); i++) {
+            encoders.push_back(thread(&AsyncBlockCompressor::EncoderLoop, this));
+        }
+        for (const string &path: paths) {
+            JOBS.push_back(unique_ptr<FileJob>(new FileJob()));
+            JOBS.back()->inputPath = path;
+        }
+
+        size_t nextJob = 0, jobsClosed = 0;
+        unsigned inFlight = 0;
+        while (jobsClosed < JOBS.size()) {
+            // Keep the pipeline full, across file boundaries
+            while (inFlight < DEPTH && nextJob < JOBS.size()) {
+                FileJob &job = *JOBS[nextJob];
+                if (job.nextRead == 0 && !OpenJob(job)) {
+                    CloseJob(job);
+                    jobsClosed++;
+                    nextJob++;
+                    continue;
+                }
+                StartBlock(job);
+                inFlight++;
+                if (job.nextRead == job.numBlocks) {
+                    nextJob++;
+                }
+            }
+            if (inFlight == 0) {
+                continue;
+            }
+
+            AsyncIORequest *request = BACKEND->WaitCompletion();
+            BlockState *block = static_cast<BlockState *>(request->owner);
+            if (!request->isWrite) {
+                ReadCompleted(*block);
+            } else if (WriteCompleted(*block)) {
+                FileJob &job = *block->job;
+                delete block;
+                inFlight--;
+                job.blocksRetired++;
+                if (job.blocksRetired == job.numBlocks) {
+                    CloseJob(job);
+                    jobsClosed++;
+                }
+            }
+        }
+        {
+            lock_guard<mutex> guard(ENCODE_SECTION);
+            STOPPING = true;
+        }
+        ENCODE_SIGNAL.notify_all();
+        for (thread &encoder: encoders) {
+            encoder.join();
+        }
+
+        SUMMARY.seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+        return SUMMARY;
+    }
+
+    /**
+     * BackendName() Name of the I/O backend in use
+     * @return Character Pointer
+     */
+    const char *BackendName() const {
+        return BACKEND->Name();
+    }
+
+private:
+    struct FileJob;
+
+    /**
+     * @struct One Block moving through read, encode and write
+     */
+    struct BlockState {
+        FileJob *job = nullptr; // Owning File
+        uint32_t index = 0; // Block Index within the File
+        vector<char> raw; // Input Bytes
+        size_t rawFilled = 0; // Input Bytes Read so far
+        string encoded; // Output Bytes
+        size_t encodedWritten = 0; // Output Bytes Written so far
+        uint64_t writeOffset = 0; // Output Offset
+        AsyncIORequest request; // Request in Flight
+    };
+
+    /**
+     * @struct Per File Progress
+     */
+    struct FileJob {
+        string inputPath; // Source Path
+        int inFd = -1, outFd = -1; // Descriptors
+        uint64_t size = 0; // Source Size
+        uint32_t numBlocks = 0; // Number of Blocks
+        uint32_t nextRead = 0; // Next Block to Read
+        uint32_t blocksRetired = 0; // Blocks Fully Written
+        bool failed = false; // I/O Error Seen
+        mutex sequence; // Guards the fields below
+        uint32_t nextWrite = 0; // Next Block to Write
+        uint64_t writeOffset = 0; // End of Submitted Output
+        map<uint32_t, BlockState *> ready; // Encoded Blocks Waiting for their Turn
+    };
+
+    // Input Block Size
+    size_t INPUT_BLOCK;
+    // Blocks in Flight
+    unsigned DEPTH;
+    // I/O Backend
+    unique_ptr<AsyncIOBackend> BACKEND;
+    // Blocks carry a CRC32C
+    bool CHECKSUMS;
+    // Files of the Current Run
+    vector<unique_ptr<FileJob> > JOBS;
+    // Read Blocks Waiting for an Encoder
+    deque<BlockState *> ENCODE_QUEUE;
+    // Guards ENCODE_QUEUE and STOPPING
+    mutex ENCODE_SECTION;
+    // Signalled on new Blocks to Encode
+    condition_variable ENCODE_SIGNAL;
+    // The Run is over, encoders leave once the queue is empty
+    bool STOPPING = false;
+    // Totals of the Current Run
+    CompressionSummary SUMMARY;
+
+    /**
+     * OpenJob() Open source and destination and count the blocks
+     * @param job FileJob
+     * @return Boolean Condition
+     */
+    bool OpenJob(FileJob &job) {
+        struct stat info;
+        job.inFd = open(job.inputPath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (job.inFd < 0 || fstat(job.inFd, &info) != 0 || !S_ISREG(info.st_mode)) {
+            job.failed = true;
+            return false;
+        }
+        string outputPath = job.inputPath + COMPRESSED_SUFFIX;
+        job.outFd = open(outputPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (job.outFd < 0) {
+            job.failed = true;
+            return false;
+        }
+        job.size = uint64_t(info.st_size);
+        // An empty file still produces one (empty) block carrying the header and end marker
+        job.numBlocks = uint32_t(max<uint64_t>(1, (job.size + INPUT_BLOCK - 1) / INPUT_BLOCK));
+        return true;
+    }
+
+    /**
+     * CloseJob() Close descriptors, drop output of failed files and update totals
+     * @param job FileJob
+     */
+    void CloseJob(FileJob &job) {
+        if (job.inFd >= 0) {
+            close(job.inFd);
+        }
+        if (job.outFd >= 0) {
+            close(job.outFd);
+        }
+        if (job.failed) {
+            if (job.outFd >= 0) {
+                unlink((job.inputPath + COMPRESSED_SUFFIX).c_str());
+            }
+            SUMMARY.filesFailed++;
+        } else {
+            SUMMARY.filesDone++;
+            SUMMARY.bytesIn += job.size;
+            SUMMARY.bytesOut += job.writeOffset;
+        }
+        job.inFd = job.outFd = -1;
+    }
+
+    /**
+     * StartBlock() Allocate the next block of a file and submit its read
+     * @param job FileJob
+     */
+    void StartBlock(FileJob &job) {
+        BlockState *block = new BlockState();
+        block->job = &job;
+        block->index = job.nextRead++;
+        uint64_t offset = uint64_t(block->index) * INPUT_BLOCK;
+        block->raw.resize(size_t(min<uint64_t>(INPUT_BLOCK, job.size - offset)));
+        if (block->raw.empty()) {
+            Encode(block);
+            return;
+        }
+        SubmitRead(*block);
+    }
+
+    /**
+     * SubmitRead() Submit a read for the unfilled part of a block
+     * @param block BlockState
+     */
+    void SubmitRead(BlockState &block) {
+        AsyncIORequest &request = block.request;
+        request = AsyncIORequest();
+        request.fd = block.job->inFd;
+        request.buffer = block.raw.data() + block.rawFilled;
+        request.length = block.raw.size() - block.rawFilled;
+        request.offset = uint64_t(block.index) * INPUT_BLOCK + block.rawFilled;
+        request.owner = &block;
+        BACKEND->Submit(&request);
+    }
+
+    /**
+     * ReadCompleted() Resubmit short reads, hand full blocks to an encoder
+     * @param block BlockState
+     */
+    void ReadCompleted(BlockState &block) {
+        if (block.request.result <= 0) {
+            FailBlock(&block);
+            return;
+        }
+        block.rawFilled += size_t(block.request.result);
+        if (block.rawFilled < block.raw.size()) {
+            SubmitRead(block);
+            return;
+        }
+        {
+            lock_guard<mutex> guard(ENCODE_SECTION);
+            ENCODE_QUEUE.push_back(&block);
+        }
+        ENCODE_SIGNAL.notify_one();
+    }
+
+    /**
+     * EncoderLoop() Encode queued blocks until the run is over, one per pool thread
+     */
+    void EncoderLoop() {
+        while (true) {
+            BlockState *block;
+            {
+                unique_lock<mutex> guard(ENCODE_SECTION);
+                ENCODE_SIGNAL.wait(guard, [this] { return STOPPING || !ENCODE_QUEUE.empty(); });
+                if (ENCODE_QUEUE.empty()) {
+                    return;
+                }
+                block = ENCODE_QUEUE.front();
+                ENCODE_QUEUE.pop_front();
+            }
+            Encode(block);
+        }
+    }
+
+    /**
+     * Encode() Huffman encode a block, runs on a pool thread
+     * @param block BlockState
+     */
+    void Encode(BlockState *block) {
+        if (block->index == 0) {
+            AppendStreamHeader(block->encoded, CHECKSUMS);
+        }
+        AppendStandaloneBlock(reinterpret_cast<const unsigned char *>(block->raw.data()), block->raw.size(),
+                              block->encoded, CHECKSUMS);
+        if (block->index + 1 == block->job->numBlocks) {
+            AppendStreamEnd(block->encoded);
+        }
+        // Input is no longer needed
+        vector<char>().swap(block->raw);
+        Sequence(block);
+    }
+
+    /**
+     * FailBlock() Mark the file failed, the block still passes through the writer so it retires in order
+     * @param block BlockState
+     */
+    void FailBlock(BlockState *block) {
+        {
+            lock_guard<mutex> guard(block->job->sequence);
+            block->job->failed = true;
+        }
+        block->encoded.clear();
+        vector<char>().swap(block->raw);
+        Sequence(block);
+    }
+
+    /**
+     * Sequence() Queue an encoded block and submit every write whose turn has come
+     * @param block BlockState
+     */
+    void Sequence(BlockState *block) {
+        FileJob &job = *block->job;
+        lock_guard<mutex> guard(job.sequence);
+        job.ready[block->index] = block;
+        while (!job.ready.empty() && job.ready.begin()->first == job.nextWrite) {
+            BlockState *next = job.ready.begin()->second;
+            job.ready.erase(job.ready.begin());
+            job.nextWrite++;
+            if (job.failed) {
+                // Nothing useful to write, a zero length write still retires the block
+                next->encoded.clear();
+            }
+            next->writeOffset = job.writeOffset;
+            job.writeOffset += next->encoded.size();
+            SubmitWrite(*next);
+        }
+    }
+
+    /**
+     * SubmitWrite() Submit a write for the unwritten part of a block
+     * @param block BlockState
+     */
+    void SubmitWrite(BlockState &block) {
+        AsyncIORequest &request = block.request;
+        request = AsyncIORequest();
+        request.isWrite = true;
+        request.fd = block.job->outFd;
+        request.buffer = &block.encoded[0] + block.encodedWritten;
+        request.length = block.encoded.size() - block.encodedWritten;
+        request.offset = block.writeOffset + block.encodedWritten;
+        request.owner = &block;
+        BACKEND->Submit(&request);
+    }
+
+    /**
+     * WriteCompleted() Resubmit short writes
+     * @param block BlockState
+     * @return Boolean Condition, true when the block is fully written and can retire
+     */
+    bool WriteCompleted(BlockState &block) {
+        if (block.request.result < 0) {
+            lock_guard<mutex> guard(block.job->sequence);
+            block.job->failed = true;
+            return true;
+        }
+        block.encodedWritten += size_t(block.request.result);
+        if (block.encodedWritten < block.encoded.size() && block.request.result > 0) {
+            SubmitWrite(block);
+            return false;
+        }
+        if (block.encodedWritten < block.encoded.size()) {
+            lock_guard<mutex> guard(block.job->sequence);
+            block.job->failed = true;
+        }
+        return true;
+    }
+};
+
+#endif //EKHUFFMANPROJECT_ASYNCBLOCKCOMPRESSOR_H
@@ -0,0 +1,457 @@
+/**
+ * @file : AsyncFileIO.h
+ * @author : Edwin Kaburu
+ * @date : 10/18/2026
+ *
+ * Asynchronous positional file reads and writes. Uses Linux io_uring when the kernel allows it and falls back
+ * to a pool of threads issuing pread/pwrite everywhere else.
+ */
+#ifndef EKHUFFMANPROJECT_ASYNCFILEIO_H
+#define EKHUFFMANPROJECT_ASYNCFILEIO_H
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <set>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#define EKHUFFMAN_HAVE_IO_URING 1
+#endif
+#endif
+
+using namespace std;
+
+/**
+ * @struct A Single Read or Write, owned by the caller until its completion is returned
+ */
+struct AsyncIORequest {
+    int fd = -1; // File Descriptor
+    bool isWrite = false; // Write instead of Read
+    char *buffer = nullptr; // Data Buffer
+    size_t length = 0; // Number of Bytes
+    uint64_t offset = 0; // File Offset
+    void *owner = nullptr; // Caller Context
+    long result = 0; // Bytes Transferred, or -errno
+    struct iovec ioVector = {nullptr, 0}; // Kernel Visible Buffer Descriptor
+};
+
+/**
+ * @class AsyncIOBackend . Submission and completion of AsyncIORequests.
+ */
+class AsyncIOBackend {
+public:
+    /**
+     * Submit() Queue a request, safe to call from any thread. Every request comes back from WaitCompletion()
+     * exactly once, with a negative result when it could not be run
+     * @param request AsyncIORequest, must stay alive until returned by WaitCompletion()
+     */
+    virtual void Submit(AsyncIORequest *request) = 0;
+
+    /**
+     * WaitCompletion() Block until a request finishes, single consumer
+     * @return AsyncIORequest with its result filled in
+     */
+    virtual AsyncIORequest *WaitCompletion() = 0;
+
+    /**
+     * Name() Backend Name
+     * @return Character Pointer
+     */
+    virtual const char *Name() const = 0;
+
+    /**
+     * ~AsyncIOBackend() Destructor for AsyncIOBackend
+     */
+    virtual ~AsyncIOBackend() {
+
+    }
+};
+
+/**
+ * @class ThreadPoolIOBackend . Portable backend, worker threads run blocking pread/pwrite.
+ */
+class ThreadPoolIOBackend : public AsyncIOBackend {
+public:
+    /**
+     * ThreadPoolIOBackend() Constructor To Create Instance of ThreadPoolIOBackend
+     * @param numThreads Integer Number of Worker Threads
+     */
+    explicit ThreadPoolIOBackend(int numThreads) {
+        for (int i = 0; i < max(numThreads, 1); i++) {
+            WORKERS.push_back(thread(&ThreadPoolIOBackend::WorkerLoop, this));
+        }
+    }
+
+    void Submit(AsyncIORequest *request) override {
+        {
+            lock_guard<mutex> guard(CRITICAL_SECTION);
+            SUBMITTED.push_back(request);
+        }
+        SUBMIT_SIGNAL.notify_one();
+    }
+
+    AsyncIORequest *WaitCompletion() override {
+        unique_lock<mutex> guard(CRITICAL_SECTION);
+        COMPLETE_SIGNAL.wait(guard, [this] { return !COMPLETED.empty(); });
+        AsyncIORequest *request = COMPLETED.front();
+        COMPLETED.pop_front();
+        return request;
+    }
+
+    const char *Name() const override {
+        return "threads";
+    }
+
+    /**
+     * ~ThreadPoolIOBackend() Destructor, stops and joins the workers
+     */
+    ~ThreadPoolIOBackend() override {
+        {
+            lock_guard<mutex> guard(CRITICAL_SECTION);
+            STOPPING = true;
+        }
+        SUBMIT_SIGNAL.notify_all();
+        for (thread &worker: WORKERS) {
+            worker.join();
+        }
+    }
+
+private:
+    // Worker Threads
+    vector<thread> WORKERS;
+    // Requests Waiting for a Worker
+    deque<AsyncIORequest *> SUBMITTED;
+    // Finished Requests
+    deque<AsyncIORequest *> COMPLETED;
+    // Mutex Critical Section
+    mutex CRITICAL_SECTION;
+    // Signalled on Submission
+    condition_variable SUBMIT_SIGNAL;
+    // Signalled on Completion
+    condition_variable COMPLETE_SIGNAL;
+    // Shutdown Requested
+    bool STOPPING = false;
+
+    /**
+     * WorkerLoop() Run submitted requests until shutdown
+     */
+    void WorkerLoop() {
+        while (true) {
+            AsyncIORequest *request;
+            {
+                unique_lock<mutex> guard(CRITICAL_SECTION);
+                SUBMIT_SIGNAL.wait(guard, [this] { return STOPPING || !SUBMITTED.empty(); });
+                if (SUBMITTED.empty()) {
+                    return;
+                }
+                request = SUBMITTED.front();
+                SUBMITTED.pop_front();
+            }
+
+            ssize_t done;
+            if (request->isWrite) {
+                done = pwrite(request->fd, request->buffer, request->length, off_t(request->offset));
+            } else {
+                done = pread(request->fd, request->buffer, request->length, off_t(request->offset));
+            }
+            request->result = done < 0 ? -long(errno) : long(done);
+
+            {
+                lock_guard<mutex> guard(CRITICAL_SECTION);
+                COMPLETED.push_back(request);
+            }
+            COMPLETE_SIGNAL.notify_one();
+        }
+    }
+};
+
+#ifdef EKHUFFMAN_HAVE_IO_URING
+
+/**
+ * @class IoUringBackend . Linux io_uring backend, talks to the kernel rings directly through the raw syscalls.
+ * The kernel cancels requests whose submitting thread exits, so Submit() only queues and every io_uring_enter is
+ * made by the thread calling WaitCompletion().
+ */
+class IoUringBackend : public AsyncIOBackend {
+public:
+    /**
+     * IoUringBackend() Constructor To Create Instance of IoUringBackend, check IsReady() afterwards
+     * @param queueDepth Integer Number of Submission Entries
+     */
+    explicit IoUringBackend(unsigned queueDepth) {
+        struct io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        RING_FD = int(syscall(__NR_io_uring_setup, queueDepth, &params));
+        if (RING_FD < 0) {
+            return;
+        }
+        if (pipe2(WAKE_PIPE, O_CLOEXEC | O_NONBLOCK) != 0) {
+            Release();
+            return;
+        }
+
+        SQ_RING_SIZE = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        CQ_RING_SIZE = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+        bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap) {
+            SQ_RING_SIZE = CQ_RING_SIZE = max(SQ_RING_SIZE, CQ_RING_SIZE);
+        }
+
+        SQ_RING = MapRing(SQ_RING_SIZE, IORING_OFF_SQ_RING);
+        CQ_RING = singleMap ? SQ_RING : MapRing(CQ_RING_SIZE, IORING_OFF_CQ_RING);
+        SQE_SIZE = params.sq_entries * sizeof(struct io_uring_sqe);
+        SQES = static_cast<struct io_uring_sqe *>(MapRing(SQE_SIZE, IORING_OFF_SQES));
+        if (SQ_RING == nullptr || CQ_RING == nullptr || SQES == nullptr) {
+            Release();
+            return;
+        }
+
+        char *sq = static_cast<char *>(SQ_RING);
+        char *cq = static_cast<char *>(CQ_RING);
+        SQ_HEAD = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+        SQ_TAIL = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+        SQ_MASK = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+        SQ_ARRAY = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+        SQ_ENTRIES = params.sq_entries;
+        CQ_HEAD = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+        CQ_TAIL = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+        CQ_MASK = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+        CQES = reinterpret_cast<struct io_uring_cqe *>(cq + params.cq_off.cqes);
+    }
+
+    /**
+     * IsReady() Check if the kernel accepted the ring
+     * @return Boolean Condition
+     */
+    bool IsReady() const {
+        return RING_FD >= 0;
+    }
+
+    void Submit(AsyncIORequest *request) override {
+        bool wake;
+        {
+            lock_guard<mutex> guard(CRITICAL_SECTION);
+            if (BROKEN != 0) {
+                request->result = -long(BROKEN);
+                FAILED.push_back(request);
+            } else {
+                BACKLOG.push_back(request);
+                IN_FLIGHT.insert(request);
+            }
+            wake = WAITING;
+            WAITING = false;
+        }
+        if (wake) {
+            char signal = 1;
+            ssize_t ignored = write(WAKE_PIPE[1], &signal, 1);
+            (void) ignored;
+        }
+    }
+
+    AsyncIORequest *WaitCompletion() override {
+        while (true) {
+            unsigned toSubmit;
+            {
+                lock_guard<mutex> guard(CRITICAL_SECTION);
+                if (!FAILED.empty()) {
+                    AsyncIORequest *request = FAILED.front();
+                    FAILED.pop_front();
+                    return request;
+                }
+                unsigned head = *CQ_HEAD;
+                if (head != __atomic_load_n(CQ_TAIL, __ATOMIC_ACQUIRE)) {
+                    struct io_uring_cqe *entry = &CQES[head & CQ_MASK];
+                    AsyncIORequest *request = reinterpret_cast<AsyncIORequest *>(entry->user_data);
+                    request->result = entry->res;
+                    __atomic_store_n(CQ_HEAD, head + 1, __ATOMIC_RELEASE);
+                    IN_FLIGHT.erase(request);
+                    return request;
+                }
+                toSubmit = FillSubmissionQueue();
+                WAITING = toSubmit == 0;
+            }
+
+            bool retry = false;
+            if (toSubmit > 0) {
+                long submitted = syscall(__NR_io_uring_enter, RING_FD, toSubmit, 0, 0, nullptr, 0);
+                if (submitted >= 0) {
+                    continue;
+                }
+                if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                    FailInFlight(errno);
+                    continue;
+                }
+                // Out of kernel resources or completions, entries stay queued until some complete
+                retry = errno != EINTR;
+            }
+
+            struct pollfd watched[2] = {{RING_FD, POLLIN, 0}, {WAKE_PIPE[0], POLLIN, 0}};
+            if (poll(watched, 2, retry ? 1 : -1) < 0 && errno != EINTR) {
+                FailInFlight(errno);
+                continue;
+            }
+            char drain[64];
+            while (read(WAKE_PIPE[0], drain, sizeof(drain)) > 0) {
+            }
+            lock_guard<mutex> guard(CRITICAL_SECTION);
+            WAITING = false;
+        }
+    }
+
+    const char *Name() const override {
+        return "io_uring";
+    }
+
+    /**
+     * ~IoUringBackend() Destructor, unmaps the rings and closes the ring descriptor
+     */
+    ~IoUringBackend() override {
+        Release();
+    }
+
+private:
+    // Ring File Descriptor
+    int RING_FD = -1;
+    // Mapped Rings and their Sizes
+    void *SQ_RING = nullptr;
+    void *CQ_RING = nullptr;
+    struct io_uring_sqe *SQES = nullptr;
+    size_t SQ_RING_SIZE = 0, CQ_RING_SIZE = 0, SQE_SIZE = 0;
+    // Submission Ring Fields
+    unsigned *SQ_HEAD = nullptr, *SQ_TAIL = nullptr, *SQ_ARRAY = nullptr;
+    unsigned SQ_MASK = 0, SQ_ENTRIES = 0;
+    // Completion Ring Fields
+    unsigned *CQ_HEAD = nullptr, *CQ_TAIL = nullptr;
+    unsigned CQ_MASK = 0;
+    struct io_uring_cqe *CQES = nullptr;
+    // Wakes WaitCompletion() on new requests, read end first
+    int WAKE_PIPE[2] = {-1, -1};
+    // Mutex Critical Section, guards the rings and the fields below
+    mutex CRITICAL_SECTION;
+    // Submitted Requests not yet in the Submission Ring
+    deque<AsyncIORequest *> BACKLOG;
+    // Submitted Requests not yet Completed
+    set<AsyncIORequest *> IN_FLIGHT;
+    // Requests failed without a Completion Entry
+    deque<AsyncIORequest *> FAILED;
+    // WaitCompletion() is about to block and needs a wake up
+    bool WAITING = false;
+    // errno that broke the Ring, zero while it works
+    int BROKEN = 0;
+
+    /**
+     * FillSubmissionQueue() Move backlog requests into free submission entries, under CRITICAL_SECTION
+     * @return Number of Entries the Kernel has not consumed yet
+     */
+    unsigned FillSubmissionQueue() {
+        unsigned tail = *SQ_TAIL;
+        while (!BACKLOG.empty() && tail - __atomic_load_n(SQ_HEAD, __ATOMIC_ACQUIRE) < SQ_ENTRIES) {
+            AsyncIORequest *request = BACKLOG.front();
+            BACKLOG.pop_front();
+            unsigned index = tail & SQ_MASK;
+            struct io_uring_sqe *entry = &SQES[index];
+            memset(entry, 0, sizeof(*entry));
+            request->ioVector.iov_base = request->buffer;
+            request->ioVector.iov_len = request->length;
+            entry->opcode = request->isWrite ? IORING_OP_WRITEV : IORING_OP_READV;
+            entry->fd = request->fd;
+            entry->addr = reinterpret_cast<uint64_t>(&request->ioVector);
+            entry->len = 1;
+            entry->off = request->offset;
+            entry->user_data = reinterpret_cast<uint64_t>(request);
+            SQ_ARRAY[index] = index;
+            tail++;
+        }
+        __atomic_store_n(SQ_TAIL, tail, __ATOMIC_RELEASE);
+        return tail - __atomic_load_n(SQ_HEAD, __ATOMIC_ACQUIRE);
+    }
+
+    /**
+     * FailInFlight() The ring stopped working, fail every request not yet completed and any submitted later
+     * @param error Integer errno
+     */
+    void FailInFlight(int error) {
+        lock_guard<mutex> guard(CRITICAL_SECTION);
+        BROKEN = error;
+        for (AsyncIORequest *request: IN_FLIGHT) {
+            request->result = -long(error);
+            FAILED.push_back(request);
+        }
+        IN_FLIGHT.clear();
+        BACKLOG.clear();
+    }
+
+    /**
+     * MapRing() Map one of the shared ring regions
+     * @param size Number of Bytes
+     * @param offset Ring Region Offset
+     * @return Mapped Pointer, nullptr on failure
+     */
+    void *MapRing(size_t size, off_t offset) {
+        void *mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RING_FD, offset);
+        return mapped == MAP_FAILED ? nullptr : mapped;
+    }
+
+    /**
+     * Release() Unmap the rings and close the descriptor
+     */
+    void Release() {
+        if (SQES != nullptr) {
+            munmap(SQES, SQE_SIZE);
+        }
+        if (CQ_RING != nullptr && CQ_RING != SQ_RING) {
+            munmap(CQ_RING, CQ_RING_SIZE);
+        }
+        if (SQ_RING != nullptr) {
+            munmap(SQ_RING, SQ_RING_SIZE);
+        }
+        SQES = nullptr;
+        SQ_RING = CQ_RING = nullptr;
+        if (RING_FD >= 0) {
+            close(RING_FD);
+            RING_FD = -1;
+        }
+        for (int &fd: WAKE_PIPE) {
+            if (fd >= 0) {
+                close(fd);
+                fd = -1;
+            }
+        }
+    }
+};
+
+#endif
+
+/**
+ * CreateIOBackend() Pick the fastest backend available on this system
+ * @param queueDepth Integer Requests kept in flight
+ * @param preferThreads Boolean Condition, skip io_uring
+ * @return AsyncIOBackend
+ */
+static unique_ptr<AsyncIOBackend> CreateIOBackend(unsigned queueDepth, bool preferThreads = false) {
+#ifdef EKHUFFMAN_HAVE_IO_URING
+    if (!preferThreads) {
+        unique_ptr<IoUringBackend> ring(new IoUringBackend(queueDepth));
+        if (ring->IsReady()) {
+            return unique_ptr<AsyncIOBackend>(ring.release());
+        }
+    }
+#endif
+    return unique_ptr<AsyncIOBackend>(new ThreadPoolIOBackend(int(queueDepth)));
+}
+
+#endif //EKHUFFMANPROJECT_ASYNCFILEIO_H
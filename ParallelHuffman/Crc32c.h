@@ -0,0 +1,186 @@
+/**
+ * @file : Crc32c.h
+ * @author : Edwin Kaburu
+ * @date : 10/18/2026
+ *
+ * CRC32C (Castagnoli) checksums for compressed blocks. Uses the SSE4.2 crc32 instruction when the CPU has it,
+ * the ARMv8 CRC instructions when the build targets them, and a slicing-by-8 table everywhere else. Every path
+ * gives the same value, so streams written on one machine verify on any other.
+ */
+#ifndef EKHUFFMANPROJECT_CRC32C_H
+#define EKHUFFMANPROJECT_CRC32C_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <nmmintrin.h>
+#define EK_CRC32C_SSE42 1
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define EK_CRC32C_ARMV8 1
+#endif
+
+using namespace std;
+
+// Reflected Castagnoli Polynomial
+const uint32_t CRC32C_POLYNOMIAL = 0x82F63B78;
+
+/**
+ * @struct Slicing-by-8 lookup tables, TABLE[0] is the classic byte at a time table
+ */
+struct Crc32cTables {
+    uint32_t TABLE[8][256];
+
+    Crc32cTables() {
+        for (uint32_t b = 0; b < 256; b++) {
+            uint32_t crc = b;
+            for (int bit = 0; bit < 8; bit++) {
+                crc = (crc >> 1) ^ ((crc & 1) ? CRC32C_POLYNOMIAL : 0);
+            }
+            TABLE[0][b] = crc;
+        }
+        for (uint32_t b = 0; b < 256; b++) {
+            for (int t = 1; t < 8; t++) {
+                TABLE[t][b] = (TABLE[t - 1][b] >> 8) ^ TABLE[0][TABLE[t - 1][b] & 0xFF];
+            }
+        }
+    }
+};
+
+/**
+ * Crc32cTableUpdate() Advance a raw (pre-inverted) CRC over bytes, eight at a time through the tables
+ * @param crc Unsigned Integer Running CRC
+ * @param data Byte Pointer
+ * @param size Number of Bytes
+ * @return Unsigned Integer Running CRC
+ */
+inline uint32_t Crc32cTableUpdate(uint32_t crc, const unsigned char *data, size_t size) {
+    static const Crc32cTables tables;
+    const uint32_t (*table)[256] = tables.TABLE;
+    for (; size >= 8; size -= 8, data += 8) {
+        uint32_t low = crc ^ (uint32_t(data[0]) | (uint32_t(data[1]) << 8) | (uint32_t(data[2]) << 16) |
+                              (uint32_t(data[3]) << 24));
+        crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^ table[5][(low >> 16) & 0xFF] ^
+              table[4][low >> 24] ^ table[3][data[4]] ^ table[2][data[5]] ^ table[1][data[6]] ^ table[0][data[7]];
+    }
+    for (; size > 0; size--, data++) {
+        crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xFF];
+    }
+    return crc;
+}
+
+#if defined(EK_CRC32C_SSE42)
+
+/**
+ * Crc32cHardwareUpdate() Advance a raw CRC with the SSE4.2 crc32 instruction, only called when the CPU has it
+ * @param crc Unsigned Integer Running CRC
+ * @param data Byte Pointer
+ * @param size Number of Bytes
+ * @return Unsigned Integer Running CRC
+ */
+__attribute__((target("sse4.2")))
+inline uint32_t Crc32cHardwareUpdate(uint32_t crc, const unsigned char *data, size_t size) {
+    uint64_t wide = crc;
+    for (; size >= 8; size -= 8, data += 8) {
+        uint64_t word;
+        memcpy(&word, data, 8);
+        wide = _mm_crc32_u64(wide, word);
+    }
+    crc = uint32_t(wide);
+    for (; size > 0; size--, data++) {
+        crc = _mm_crc32_u8(crc, *data);
+    }
+    return crc;
+}
+
+/**
+ * Crc32cHasHardware() Check once whether the CPU has SSE4.2
+ * @return Boolean Condition
+ */
+inline bool Crc32cHasHardware() {
+    static const bool supported = __builtin_cpu_supports("sse4.2");
+    return supported;
+}
+
+#elif defined(EK_CRC32C_ARMV8)
+
+/**
+ * Crc32cHardwareUpdate() Advance a raw CRC with the ARMv8 crc32c instructions
+ * @param crc Unsigned Integer Running CRC
+ * @param data Byte Pointer
+ * @param size Number of Bytes
+ * @return Unsigned Integer Running CRC
+ */
+inline uint32_t Crc32cHardwareUpdate(uint32_t crc, const unsigned char *data, size_t size) {
+    for (; size >= 8; size -= 8, data += 8) {
+        uint64_t word;
+        memcpy(&word, data, 8);
+        crc = __crc32cd(crc, word);
+    }
+    for (; size > 0; size--, data++) {
+        crc = __crc32cb(crc, *data);
+    }
+    return crc;
+}
+
+/**
+ * Crc32cHasHardware() The build targets the CRC extension, so every CPU it runs on has it
+ * @return Boolean Condition
+ */
+inline bool Crc32cHasHardware() {
+    return true;
+}
+
+#else
+
+/**
+ * Crc32cHardwareUpdate() No CRC instructions in this build, the tables do the work
+ * @param crc Unsigned Integer Running CRC
+ * @param data Byte Pointer
+ * @param size Number of Bytes
+ * @return Unsigned Integer Running CRC
+ */
+inline uint32_t Crc32cHardwareUpdate(uint32_t crc, const unsigned char *data, size_t size) {
+    return Crc32cTableUpdate(crc, data, size);
+}
+
+/**
+ * Crc32cHasHardware() No CRC instructions in this build
+ * @return Boolean Condition
+ */
+inline bool Crc32cHasHardware() {
+    return false;
+}
+
+#endif
+
+/**
+ * Crc32c() Extend a CRC32C over more bytes, start from zero, chained calls equal one call over the whole range
+ * @param crc Unsigned Integer CRC of the bytes so far
+ * @param data Byte Pointer
+ * @param size Number of Bytes
+ * @return Unsigned Integer CRC
+ */
+inline uint32_t Crc32c(uint32_t crc, const unsigned char *data, size_t size) {
+    crc = ~crc;
+    crc = Crc32cHasHardware() ? Crc32cHardwareUpdate(crc, data, size) : Crc32cTableUpdate(crc, data, size);
+    return ~crc;
+}
+
+/**
+ * Crc32cBackend() Name of the implementation Crc32c() uses on this machine
+ * @return Character Pointer
+ */
+inline const char *Crc32cBackend() {
+#if defined(EK_CRC32C_SSE42)
+    return Crc32cHasHardware() ? "sse4.2" : "table";
+#elif defined(EK_CRC32C_ARMV8)
+    return "armv8";
+#else
+    return "table";
+#endif
+}
+
+#endif //EKHUFFMANPROJECT_CRC32C_H
@@ -0,0 +1,435 @@
+/**
+ * @file : HuffmanCodebook.h
+ * @author : Edwin Kaburu
+ * @date : 10/18/2026
+ *
+ * Canonical Huffman Codebook built from byte counts. Encodes and decodes bit-packed blocks, shared by the
+ * streaming and block compression modes.
+ */
+#ifndef EKHUFFMANPROJECT_HUFFMANCODEBOOK_H
+#define EKHUFFMANPROJECT_HUFFMANCODEBOOK_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <algorithm>
+#include "Crc32c.h"
+#include "HuffmanTreeBuilder.h"
+
+using namespace std;
+
+// Number of distinct byte symbols
+const int SYMBOL_COUNT = TREE_SYMBOLS;
+// Longest codeword allowed, keeps every code inside the 64 bit writer/reader buffers
+const int MAX_CODE_LENGTH = 24;
+// Number of bits resolved by a single decode table lookup
+const int DECODE_TABLE_BITS = 11;
+// Bytes checksummed at a time while encoding or decoding, small enough to still be in L1 cache when coded
+const size_t CHECKSUM_SLICE = 16 * 1024;
+
+/**
+ * @class BitWriter . Appends codewords, most significant bit first, to a byte string.
+ */
+class BitWriter {
+public:
+    /**
+     * BitWriter() Constructor To Create Instance of BitWriter
+     * @param output String Output, bytes are appended
+     */
+    explicit BitWriter(string &output) : OUTPUT(output) {
+
+    }
+
+    /**
+     * Put() Append a codeword
+     * @param code Unsigned Integer Codeword
+     * @param length Integer Codeword Length
+     */
+    void Put(uint32_t code, int length) {
+        ACCUMULATOR = (ACCUMULATOR << length) | code;
+        BITS += length;
+        while (BITS >= 8) {
+            BITS -= 8;
+            OUTPUT.push_back(char((ACCUMULATOR >> BITS) & 0xFF));
+        }
+    }
+
+    /**
+     * Finish() Flush remaining bits, padding the last byte with zeros
+     */
+    void Finish() {
+        if (BITS > 0) {
+            OUTPUT.push_back(char((ACCUMULATOR << (8 - BITS)) & 0xFF));
+            BITS = 0;
+        }
+    }
+
+private:
+    // Destination Bytes
+    string &OUTPUT;
+    // Pending Bits, lowest BITS are valid
+    uint64_t ACCUMULATOR = 0;
+    // Number of Pending Bits
+    int BITS = 0;
+};
+
+/**
+ * @class BitReader . Reads bits, most significant bit first, from a byte buffer.
+ */
+class BitReader {
+public:
+    /**
+     * BitReader() Constructor To Create Instance of BitReader
+     * @param data Byte Pointer
+     * @param size Number of Bytes
+     */
+    BitReader(const unsigned char *data, size_t size) : POSITION(data), END(data + size), TOTAL_BITS(size * 8) {
+        Refill();
+    }
+
+    /**
+     * Peek() Look at the next bits without consuming them
+     * @param length Integer Number of Bits, at most 32
+     * @return Unsigned Integer Bits
+     */
+    uint32_t Peek(int length) {
+        if (BITS < length) {
+            Refill();
+        }
+        return uint32_t(BUFFER >> (64 - length));
+    }
+
+    /**
+     * Consume() Drop bits already inspected with Peek()
+     * @param length Integer Number of Bits
+     */
+    void Consume(int length) {
+        BUFFER <<= length;
+        BITS -= length;
+        CONSUMED += length;
+    }
+
+    /**
+     * IsOverrun() Check if more bits were consumed than the buffer holds
+     * @return Boolean Condition
+     */
+    bool IsOverrun() const {
+        return CONSUMED > TOTAL_BITS;
+    }
+
+private:
+    // Next Unread Byte
+    const unsigned char *POSITION;
+    // End of Buffer
+    const unsigned char *END;
+    // Size of Buffer in Bits
+    uint64_t TOTAL_BITS;
+    // Bits Consumed so far
+    uint64_t CONSUMED = 0;
+    // Buffered Bits, most significant bits are next
+    uint64_t BUFFER = 0;
+    // Number of Buffered Bits
+    int BITS = 0;
+
+    /**
+     * Refill() Load bytes into the buffer, zeros past the end
+     */
+    void Refill() {
+        while (BITS <= 56) {
+            uint64_t byte = 0;
+            if (POSITION < END) {
+                byte = *POSITION++;
+            }
+            BUFFER |= byte << (56 - BITS);
+            BITS += 8;
+        }
+    }
+};
+
+/**
+ * @class HuffmanCodebook . Canonical code for the 256 byte symbols, with encode and decode tables.
+ */
+class HuffmanCodebook {
+public:
+    /**
+     * HuffmanCodebook() Default constructor, creates an empty codebook
+     */
+    HuffmanCodebook() {
+        Clear();
+    }
+
+    /**
+     * Clear() Remove every codeword
+     */
+    void Clear() {
+        memset(LENGTHS, 0, sizeof(LENGTHS));
+        memset(CODES, 0, sizeof(CODES));
+        memset(DECODE_TABLE, 0, sizeof(DECODE_TABLE));
+        memset(FIRST_CODE, 0, sizeof(FIRST_CODE));
+        memset(LENGTH_COUNT, 0, sizeof(LENGTH_COUNT));
+        memset(LENGTH_OFFSET, 0, sizeof(LENGTH_OFFSET));
+        memset(SORTED_SYMBOLS, 0, sizeof(SORTED_SYMBOLS));
+        NUM_SYMBOLS = 0;
+    }
+
+    /**
+     * BuildFromCounts() Construct an optimal length-limited code for the given counts
+     * @param counts Array of SYMBOL_COUNT Counts
+     * @return Boolean Condition, false when every count is zero
+     */
+    bool BuildFromCounts(const uint64_t counts[SYMBOL_COUNT]) {
+        uint64_t scaled[SYMBOL_COUNT];
+        copy(counts, counts + SYMBOL_COUNT, scaled);
+
+        uint8_t lengths[SYMBOL_COUNT];
+        int maxLength = HuffmanTreeBuilder::BuildLengths(scaled, lengths);
+        if (maxLength == 0) {
+            Clear();
+            return false;
+        }
+        // Flatten the distribution until the deepest codeword fits
+        while (maxLength > MAX_CODE_LENGTH) {
+            for (int s = 0; s < SYMBOL_COUNT; s++) {
+                if (scaled[s] > 0) {
+                    scaled[s] = (scaled[s] >> 1) | 1;
+                }
+            }
+            maxLength = HuffmanTreeBuilder::BuildLengths(scaled, lengths);
+        }
+        return SetLengths(lengths);
+    }
+
+    /**
+     * SetLengths() Install codeword lengths, as read back from a stream
+     * @param lengths Array of SYMBOL_COUNT Lengths, zero for unused symbols
+     * @return Boolean Condition, false when the lengths do not form a prefix code
+     */
+    bool SetLengths(const uint8_t lengths[SYMBOL_COUNT]) {
+        Clear();
+        // Kraft inequality, measured in units of 2^-MAX_CODE_LENGTH
+        uint64_t kraft = 0;
+        for (int s = 0; s < SYMBOL_COUNT; s++) {
+            if (lengths[s] > MAX_CODE_LENGTH) {
+                return false;
+            }
+            if (lengths[s] > 0) {
+                kraft += uint64_t(1) << (MAX_CODE_LENGTH - lengths[s]);
+                NUM_SYMBOLS++;
+            }
+        }
+        if (NUM_SYMBOLS == 0 || kraft > (uint64_t(1) << MAX_CODE_LENGTH)) {
+            NUM_SYMBOLS = 0;
+            return false;
+        }
+        copy(lengths, lengths + SYMBOL_COUNT, LENGTHS);
+        AssignCodes();
+        return true;
+    }
+
+    /**
+     * Lengths() Codeword lengths indexed by symbol
+     * @return Array of SYMBOL_COUNT Lengths
+     */
+    const uint8_t *Lengths() const {
+        return LENGTHS;
+    }
+
+    /**
+     * IsEmpty() Check if the codebook has no codewords
+     * @return Boolean Condition
+     */
+    bool IsEmpty() const {
+        return NUM_SYMBOLS == 0;
+    }
+
+    /**
+     * CanEncode() Check if every symbol with a non-zero count has a codeword
+     * @param counts Array of SYMBOL_COUNT Counts
+     * @return Boolean Condition
+     */
+    bool CanEncode(const uint64_t counts[SYMBOL_COUNT]) const {
+        for (int s = 0; s < SYMBOL_COUNT; s++) {
+            if (counts[s] > 0 && LENGTHS[s] == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * EstimateBits() Payload size in bits of data with the given counts
+     * @param counts Array of SYMBOL_COUNT Counts
+     * @return Number of Bits, UINT64_MAX when a counted symbol has no codeword
+     */
+    uint64_t EstimateBits(const uint64_t counts[SYMBOL_COUNT]) const {
+        uint64_t bits = 0;
+        for (int s = 0; s < SYMBOL_COUNT; s++) {
+            if (counts[s] > 0 && LENGTHS[s] == 0) {
+                return UINT64_MAX;
+            }
+            bits += counts[s] * LENGTHS[s];
+        }
+        return bits;
+    }
+
+    /**
+     * EncodeBlock() Encode bytes and append the bit-packed payload to output
+     * @param data Byte Pointer
+     * @param size Number of Bytes
+     * @param output String Output
+     * @param checksum Unsigned Integer Pointer, when not null receives the CRC32C of data, taken slice by slice
+     * just ahead of coding each slice
+     * @return Number of Bytes Appended
+     */
+    size_t EncodeBlock(const unsigned char *data, size_t size, string &output, uint32_t *checksum = nullptr) const {
+        size_t before = output.size();
+        BitWriter writer(output);
+        uint32_t crc = 0;
+        for (size_t begin = 0; begin < size; begin += CHECKSUM_SLICE) {
+            size_t end = min(size, begin + CHECKSUM_SLICE);
+            if (checksum != nullptr) {
+                crc = Crc32c(crc, data + begin, end - begin);
+            }
+            for (size_t i = begin; i < end; i++) {
+                writer.Put(CODES[data[i]], LENGTHS[data[i]]);
+            }
+        }
+        writer.Finish();
+        if (checksum != nullptr) {
+            *checksum = crc;
+        }
+        return output.size() - before;
+    }
+
+    /**
+     * DecodeBlock() Decode a bit-packed payload and append the bytes to output
+     * @param payload Byte Pointer
+     * @param payloadSize Number of Payload Bytes
+     * @param rawSize Number of Bytes to Decode
+     * @param output String Output
+     * @param checksum Unsigned Integer Pointer, when not null receives the CRC32C of the decoded bytes, taken slice
+     * by slice right after decoding each slice
+     * @return Boolean Condition, false on corrupt payload
+     */
+    bool DecodeBlock(const unsigned char *payload, size_t payloadSize, size_t rawSize, string &output,
+                     uint32_t *checksum = nullptr) const {
+        if (checksum != nullptr) {
+            *checksum = 0;
+        }
+        if (NUM_SYMBOLS == 0) {
+            return rawSize == 0;
+        }
+        // Every codeword is at least one bit, checked before rawSize bytes are allocated
+        if (rawSize > payloadSize * 8) {
+            return false;
+        }
+        BitReader reader(payload, payloadSize);
+        size_t start = output.size();
+        output.resize(start + rawSize);
+        uint32_t crc = 0;
+        for (size_t begin = 0; begin < rawSize; begin += CHECKSUM_SLICE) {
+            size_t end = min(rawSize, begin + CHECKSUM_SLICE);
+            for (size_t i = begin; i < end; i++) {
+                int symbol = DecodeSymbol(reader);
+                if (symbol < 0) {
+                    output.resize(start);
+                    return false;
+                }
+                output[start + i] = char(symbol);
+            }
+            if (checksum != nullptr) {
+                crc = Crc32c(crc, reinterpret_cast<const unsigned char *>(&output[start + begin]), end - begin);
+            }
+        }
+        if (reader.IsOverrun()) {
+            output.resize(start);
+            return false;
+        }
+        if (checksum != nullptr) {
+            *checksum = crc;
+        }
+        return true;
+    }
+
+private:
+    // Codeword Length per Symbol
+    uint8_t LENGTHS[SYMBOL_COUNT];
+    // Codeword per Symbol, right aligned
+    uint32_t CODES[SYMBOL_COUNT];
+    // Fast Decode Entries, (symbol << 8) | length, length zero when the code is longer than the table
+    uint16_t DECODE_TABLE[1 << DECODE_TABLE_BITS];
+    // First Canonical Code of each Length
+    uint32_t FIRST_CODE[MAX_CODE_LENGTH + 1];
+    // Number of Codes of each Length
+    uint32_t LENGTH_COUNT[MAX_CODE_LENGTH + 1];
+    // Index in SORTED_SYMBOLS of the first Code of each Length
+    uint32_t LENGTH_OFFSET[MAX_CODE_LENGTH + 1];
+    // Symbols Ordered by (Length, Symbol)
+    uint8_t SORTED_SYMBOLS[SYMBOL_COUNT];
+    // Number of Symbols with a Codeword
+    int NUM_SYMBOLS = 0;
+
+    /**
+     * AssignCodes() Assign canonical codewords from LENGTHS and build the decode tables
+     */
+    void AssignCodes() {
+        for (int s = 0; s < SYMBOL_COUNT; s++) {
+            LENGTH_COUNT[LENGTHS[s]]++;
+        }
+        LENGTH_COUNT[0] = 0;
+
+        uint32_t nextCode[MAX_CODE_LENGTH + 1];
+        uint32_t code = 0, offset = 0;
+        for (int length = 1; length <= MAX_CODE_LENGTH; length++) {
+            code = (code + LENGTH_COUNT[length - 1]) << 1;
+            FIRST_CODE[length] = code;
+            nextCode[length] = code;
+            LENGTH_OFFSET[length] = offset;
+            offset += LENGTH_COUNT[length];
+        }
+
+        for (int s = 0; s < SYMBOL_COUNT; s++) {
+            int length = LENGTHS[s];
+            if (length == 0) {
+                continue;
+            }
+            CODES[s] = nextCode[length]++;
+            SORTED_SYMBOLS[LENGTH_OFFSET[length] + (CODES[s] - FIRST_CODE[length])] = uint8_t(s);
+
+            if (length <= DECODE_TABLE_BITS) {
+                // Every table index starting with this codeword resolves to the symbol
+                uint32_t first = CODES[s] << (DECODE_TABLE_BITS - length);
+                uint32_t span = uint32_t(1) << (DECODE_TABLE_BITS - length);
+                for (uint32_t i = 0; i < span; i++) {
+                    DECODE_TABLE[first + i] = uint16_t((s << 8) | length);
+                }
+            }
+        }
+    }
+
+    /**
+     * DecodeSymbol() Read a single symbol
+     * @param reader BitReader
+     * @return Integer Symbol, -1 on invalid codeword
+     */
+    int DecodeSymbol(BitReader &reader) const {
+        uint16_t entry = DECODE_TABLE[reader.Peek(DECODE_TABLE_BITS)];
+        if ((entry & 0xFF) != 0) {
+            reader.Consume(entry & 0xFF);
+            return entry >> 8;
+        }
+        // Long codeword, walk the canonical ranges
+        uint32_t bits = reader.Peek(MAX_CODE_LENGTH);
+        for (int length = DECODE_TABLE_BITS + 1; length <= MAX_CODE_LENGTH; length++) {
+            uint32_t code = bits >> (MAX_CODE_LENGTH - length);
+            uint32_t index = code - FIRST_CODE[length];
+            if (index < LENGTH_COUNT[length]) {
+                reader.Consume(length);
+                return SORTED_SYMBOLS[LENGTH_OFFSET[length] + index];
+            }
+        }
+        return -1;
+    }
+};
+
+#endif //EKHUFFMANPROJECT_HUFFMANCODEBOOK_H
@@ -0,0 +1,627 @@
+/**
+ * @file : HuffmanDaemon.h
+ * @author : Edwin Kaburu
+ * @date : 10/18/2026
+ *
+ * Long running compression daemon. One poll loop reads every client of a Unix domain socket and hands whole
+ * requests to a fixed pool of worker threads, which batch small requests and answer each client directly. Reports
+ * latency percentiles.
+ *
+ * Frame Layout (integers little endian):
+ *      request:  u8 operation | u32 payload size | payload
+ *      response: u8 status    | u32 payload size | payload
+ */
+#ifndef EKHUFFMANPROJECT_HUFFMANDAEMON_H
+#define EKHUFFMANPROJECT_HUFFMANDAEMON_H
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "AdaptiveHuffmanStream.h"
+
+using namespace std;
+
+/**
+ * @enum Daemon Request Operations
+ */
+enum DaemonOperation {
+    DAEMON_COMPRESS = 1, DAEMON_DECOMPRESS = 2, DAEMON_STATS = 3, DAEMON_SHUTDOWN = 4
+};
+
+/**
+ * @enum Daemon Response Status
+ */
+enum DaemonStatus {
+    DAEMON_OK = 0, DAEMON_ERROR = 1
+};
+
+// Requests up to this size are batched together
+const size_t DAEMON_SMALL_REQUEST = 64 * 1024;
+// Most Requests taken in one Batch
+const size_t DAEMON_BATCH_MAX = 32;
+// Largest Request Payload accepted
+const uint32_t DAEMON_MAX_PAYLOAD = 256u * 1024 * 1024;
+// Number of Latency Samples kept for Percentiles
+const size_t DAEMON_LATENCY_SAMPLES = 1 << 16;
+// Milliseconds a Worker may spend writing one Response, a Client that stops reading is then dropped
+const int DAEMON_SEND_TIMEOUT_MILLIS = 5000;
+
+/**
+ * ReadFully() Read exactly size bytes from a descriptor
+ * @param fd Integer File Descriptor
+ * @param data Character Pointer
+ * @param size Number of Bytes
+ * @return Boolean Condition
+ */
+static bool ReadFully(int fd, char *data, size_t size) {
+    while (size > 0) {
+        ssize_t got = read(fd, data, size);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got <= 0) {
+            return false;
+        }
+        data += got;
+        size -= size_t(got);
+    }
+    return true;
+}
+
+/**
+ * WriteFully() Write exactly size bytes to a descriptor
+ * @param fd Integer File Descriptor
+ * @param data Character Pointer
+ * @param size Number of Bytes
+ * @param timeoutMillis Integer, milliseconds for the whole write, negative to wait as long as it takes
+ * @return Boolean Condition, false on error or once the time is up
+ */
+static bool WriteFully(int fd, const char *data, size_t size, int timeoutMillis = -1) {
+    chrono::steady_clock::time_point deadline = chrono::steady_clock::now() + chrono::milliseconds(timeoutMillis);
+    while (size > 0) {
+        ssize_t put = send(fd, data, size, MSG_NOSIGNAL | (timeoutMillis < 0 ? 0 : MSG_DONTWAIT));
+        if (put < 0 && errno == EINTR) {
+            continue;
+        }
+        if (put < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) && timeoutMillis >= 0) {
+            // A deadline for the whole write, so a client reading a trickle cannot hold the writer either
+            int remaining = int(chrono::duration_cast<chrono::milliseconds>(
+                    deadline - chrono::steady_clock::now()).count());
+            struct pollfd watched = {fd, POLLOUT, 0};
+            if (remaining <= 0 || (poll(&watched, 1, remaining) < 0 && errno != EINTR)) {
+                return false;
+            }
+            continue;
+        }
+        if (put <= 0) {
+            return false;
+        }
+        data += put;
+        size -= size_t(put);
+    }
+    return true;
+}
+
+/**
+ * ReadFrame() Read one frame
+ * @param fd Integer File Descriptor
+ * @param kind Unsigned Integer Output, operation or status
+ * @param payload String Output
+ * @return Boolean Condition
+ */
+static bool ReadFrame(int fd, uint8_t &kind, string &payload) {
+    unsigned char header[5];
+    if (!ReadFully(fd, reinterpret_cast<char *>(header), 5)) {
+        return false;
+    }
+    kind = header[0];
+    uint32_t size = uint32_t(header[1]) | (uint32_t(header[2]) << 8) | (uint32_t(header[3]) << 16) |
+                    (uint32_t(header[4]) << 24);
+    if (size > DAEMON_MAX_PAYLOAD) {
+        return false;
+    }
+    payload.resize(size);
+    return size == 0 || ReadFully(fd, &payload[0], size);
+}
+
+/**
+ * WriteFrame() Write one frame
+ * @param fd Integer File Descriptor
+ * @param kind Unsigned Integer, operation or status
+ * @param payload String
+ * @param timeoutMillis Integer, milliseconds for the whole frame, negative to wait as long as it takes
+ * @return Boolean Condition
+ */
+static bool WriteFrame(int fd, uint8_t kind, const string &payload, int timeoutMillis = -1) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    string header(1, char(kind));
+    WriteUnsigned32(header, uint32_t(payload.size()));
+    if (!WriteFully(fd, header.data(), header.size(), timeoutMillis)) {
+        return false;
+    }
+    if (timeoutMillis >= 0) {
+        int64_t spent = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+        timeoutMillis = int(max<int64_t>(0, timeoutMillis - spent));
+    }
+    return WriteFully(fd, payload.data(), payload.size(), timeoutMillis);
+}
+
+/**
+ * @class DaemonLatencyStats . Recent request latencies and batching counters.
+ */
+class DaemonLatencyStats {
+public:
+    /**
+     * DaemonLatencyStats() Default constructor
+     */
+    DaemonLatencyStats() : SAMPLES(DAEMON_LATENCY_SAMPLES, 0) {
+
+    }
+
+    /**
+     * Record() Record one request latency
+     * @param micros Unsigned Integer Microseconds
+     */
+    void Record(uint64_t micros) {
+        lock_guard<mutex> guard(CRITICAL_SECTION);
+        SAMPLES[NUM_REQUESTS % DAEMON_LATENCY_SAMPLES] = micros;
+        NUM_REQUESTS++;
+    }
+
+    /**
+     * RecordBatch() Record one batch taken by a worker
+     * @param size Number of Requests in the Batch
+     */
+    void RecordBatch(size_t size) {
+        lock_guard<mutex> guard(CRITICAL_SECTION);
+        NUM_BATCHES++;
+        BATCHED_REQUESTS += size;
+    }
+
+    /**
+     * Report() Text report of request count, batching and latency percentiles
+     * @return String Report
+     */
+    string Report() {
+        vector<uint64_t> recent;
+        uint64_t requests, batches, batched;
+        {
+            lock_guard<mutex> guard(CRITICAL_SECTION);
+            requests = NUM_REQUESTS;
+            batches = NUM_BATCHES;
+            batched = BATCHED_REQUESTS;
+            recent.assign(SAMPLES.begin(), SAMPLES.begin() + min<uint64_t>(requests, DAEMON_LATENCY_SAMPLES));
+        }
+        ostringstream report;
+        report << "requests " << requests << "\n"
+               << "batches " << batches << "\n"
+               << "mean_batch " << (batches > 0 ? double(batched) / double(batches) : 0.0) << "\n";
+        const double percentiles[] = {50, 90, 99, 99.9};
+        for (double percentile: percentiles) {
+            report << "p" << percentile << "_us " << Percentile(recent, percentile) << "\n";
+        }
+        report << "max_us " << (recent.empty() ? 0 : *max_element(recent.begin(), recent.end())) << "\n";
+        return report.str();
+    }
+
+private:
+    // Latency Ring, in microseconds
+    vector<uint64_t> SAMPLES;
+    // Requests Recorded
+    uint64_t NUM_REQUESTS = 0;
+    // Batches Recorded
+    uint64_t NUM_BATCHES = 0;
+    // Requests inside those Batches
+    uint64_t BATCHED_REQUESTS = 0;
+    // Mutex Critical Section
+    mutex CRITICAL_SECTION;
+
+    /**
+     * Percentile() Nearest rank percentile
+     * @param samples vector<uint64_t>, reordered
+     * @param percentile Double Percentile
+     * @return Unsigned Integer Sample
+     */
+    static uint64_t Percentile(vector<uint64_t> &samples, double percentile) {
+        if (samples.empty()) {
+            return 0;
+        }
+        size_t rank = size_t(percentile / 100.0 * double(samples.size() - 1) + 0.5);
+        nth_element(samples.begin(), samples.begin() + rank, samples.end());
+        return samples[rank];
+    }
+};
+
+/**
+ * @class HuffmanDaemon . Unix socket server around the Huffman codec.
+ */
+class HuffmanDaemon {
+public:
+    /**
+     * HuffmanDaemon() Constructor To Create Instance of HuffmanDaemon
+     * @param socketPath String Unix Socket Path
+     * @param numWorkers Integer Number of Worker Threads
+     */
+    HuffmanDaemon(const string &socketPath, int numWorkers) : SOCKET_PATH(socketPath),
+                                                              NUM_WORKERS(max(numWorkers, 1)) {
+
+    }
+
+    /**
+     * Run() Serve until a shutdown request arrives
+     * @return Boolean Condition, false if the socket could not be opened
+     */
+    bool Run() {
+        LISTEN_FD = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+        struct sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (LISTEN_FD < 0 || SOCKET_PATH.size() >= sizeof(address.sun_path)) {
+            return false;
+        }
+        strncpy(address.sun_path, SOCKET_PATH.c_str(), sizeof(address.sun_path) - 1);
+        unlink(SOCKET_PATH.c_str());
+        if (bind(LISTEN_FD, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) != 0 ||
+            listen(LISTEN_FD, 128) != 0 || pipe2(WAKE_PIPE, O_CLOEXEC | O_NONBLOCK) != 0) {
+            close(LISTEN_FD);
+            return false;
+        }
+
+        vector<thread> workers;
+        for (int i = 0; i < NUM_WORKERS; i++) {
+            workers.push_back(thread(&HuffmanDaemon::WorkerLoop, this));
+        }
+
+        map<int, unique_ptr<DaemonConnection>> connections;
+        vector<struct pollfd> watched;
+        while (!STOPPING.load()) {
+            // Clients with a request at a worker are not read, their next frames wait in the socket
+            watched.clear();
+            watched.push_back({WAKE_PIPE[0], POLLIN, 0});
+            watched.push_back({LISTEN_FD, POLLIN, 0});
+            for (auto &entry: connections) {
+                if (!entry.second->busy) {
+                    watched.push_back({entry.first, POLLIN, 0});
+                }
+            }
+            if (poll(watched.data(), watched.size(), -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+
+            if (watched[0].revents != 0) {
+                char drain[64];
+                while (read(WAKE_PIPE[0], drain, sizeof(drain)) > 0) {
+                }
+                vector<DaemonConnection *> answered;
+                {
+                    lock_guard<mutex> guard(CRITICAL_SECTION);
+                    answered.swap(ANSWERED);
+                }
+                for (DaemonConnection *connection: answered) {
+                    connection->busy = false;
+                    if (connection->writeFailed || !Dispatch(*connection)) {
+                        CloseConnection(connections, connection->fd);
+                    }
+                }
+            }
+            if (watched[1].revents != 0) {
+                int clientFd;
+                while ((clientFd = accept4(LISTEN_FD, nullptr, nullptr, SOCK_CLOEXEC)) >= 0) {
+                    unique_ptr<DaemonConnection> connection(new DaemonConnection());
+                    connection->fd = clientFd;
+                    connections[clientFd] = move(connection);
+                }
+            }
+            for (size_t i = 2; i < watched.size(); i++) {
+                if (watched[i].revents != 0 && !ReadConnection(*connections[watched[i].fd])) {
+                    CloseConnection(connections, watched[i].fd);
+                }
+            }
+        }
+
+        // Queued requests are still answered, the workers leave once the queue is empty
+        {
+            lock_guard<mutex> guard(CRITICAL_SECTION);
+            STOPPING = true;
+        }
+        QUEUE_SIGNAL.notify_all();
+        for (thread &worker: workers) {
+            worker.join();
+        }
+        for (auto &entry: connections) {
+            close(entry.first);
+        }
+        close(WAKE_PIPE[0]);
+        close(WAKE_PIPE[1]);
+        close(LISTEN_FD);
+        unlink(SOCKET_PATH.c_str());
+        return true;
+    }
+
+    /**
+     * Stop() Ask Run() to return, safe from any thread
+     */
+    void Stop() {
+        STOPPING = true;
+        Wake();
+    }
+
+private:
+    struct DaemonConnection;
+
+    /**
+     * @struct One Request Waiting for a Worker
+     */
+    struct DaemonRequest {
+        uint8_t operation = 0; // DaemonOperation
+        string payload; // Request Payload
+        uint8_t status = DAEMON_OK; // DaemonStatus
+        string response; // Response Payload
+        chrono::steady_clock::time_point received; // Arrival Time
+        DaemonConnection *connection = nullptr; // Client answered by the Worker
+    };
+
+    /**
+     * @struct One Client, owned by the Run() loop; a Worker only writes to it while it is busy
+     */
+    struct DaemonConnection {
+        int fd = -1; // Client Socket
+        string inbox; // Bytes read but not yet a whole Frame
+        bool busy = false; // A Worker holds its Request
+        bool writeFailed = false; // Set by the Worker, read once the Request comes back
+        DaemonRequest request; // Request in flight
+    };
+
+    // Socket Path
+    string SOCKET_PATH;
+    // Number of Worker Threads
+    int NUM_WORKERS;
+    // Listening Socket
+    int LISTEN_FD = -1;
+    // Wakes the Run() loop, read end first
+    int WAKE_PIPE[2] = {-1, -1};
+    // Shutdown Requested
+    atomic<bool> STOPPING{false};
+    // Requests Waiting for a Worker
+    deque<DaemonRequest *> QUEUE;
+    // Connections whose Request was answered, handed back to the Run() loop
+    vector<DaemonConnection *> ANSWERED;
+    // Mutex Critical Section
+    mutex CRITICAL_SECTION;
+    // Signalled on new Requests
+    condition_variable QUEUE_SIGNAL;
+    // Latency and Batch Counters
+    DaemonLatencyStats STATS;
+
+    /**
+     * Wake() Interrupt the poll of the Run() loop
+     */
+    void Wake() {
+        char signal = 1;
+        ssize_t ignored = write(WAKE_PIPE[1], &signal, 1);
+        (void) ignored;
+    }
+
+    /**
+     * CloseConnection() Forget a client that is not busy and close its socket
+     * @param connections Map of Connections by Socket
+     * @param clientFd Integer Client Socket
+     */
+    static void CloseConnection(map<int, unique_ptr<DaemonConnection>> &connections, int clientFd) {
+        close(clientFd);
+        connections.erase(clientFd);
+    }
+
+    /**
+     * ReadConnection() Read what a readable client has sent, then hand a whole frame to the workers
+     * @param connection DaemonConnection, not busy
+     * @return Boolean Condition, false when the client hung up or sent a bad frame
+     */
+    bool ReadConnection(DaemonConnection &connection) {
+        char chunk[64 * 1024];
+        ssize_t got;
+        while ((got = recv(connection.fd, chunk, sizeof(chunk), MSG_DONTWAIT)) > 0) {
+            connection.inbox.append(chunk, size_t(got));
+            if (size_t(got) < sizeof(chunk)) {
+                break;
+            }
+        }
+        if (got == 0 || (got < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            return false;
+        }
+        return Dispatch(connection);
+    }
+
+    /**
+     * Dispatch() Queue the first whole frame of a client's inbox, one request per client at a time
+     * @param connection DaemonConnection, not busy
+     * @return Boolean Condition, false on a frame over DAEMON_MAX_PAYLOAD
+     */
+    bool Dispatch(DaemonConnection &connection) {
+        if (connection.inbox.size() < 5) {
+            return true;
+        }
+        const unsigned char *header = reinterpret_cast<const unsigned char *>(connection.inbox.data());
+        uint32_t size = uint32_t(header[1]) | (uint32_t(header[2]) << 8) | (uint32_t(header[3]) << 16) |
+                        (uint32_t(header[4]) << 24);
+        if (size > DAEMON_MAX_PAYLOAD) {
+            return false;
+        }
+        if (connection.inbox.size() < 5 + size_t(size)) {
+            return true;
+        }
+        DaemonRequest &request = connection.request;
+        request.operation = header[0];
+        request.payload.assign(connection.inbox, 5, size);
+        connection.inbox.erase(0, 5 + size_t(size));
+        request.received = chrono::steady_clock::now();
+        request.connection = &connection;
+        connection.busy = true;
+        {
+            lock_guard<mutex> guard(CRITICAL_SECTION);
+            QUEUE.push_back(&request);
+        }
+        QUEUE_SIGNAL.notify_one();
+        return true;
+    }
+
+    /**
+     * WorkerLoop() Take batches of requests off the queue, answering each client, until shutdown
+     */
+    void WorkerLoop() {
+        vector<DaemonRequest *> batch;
+        while (true) {
+            batch.clear();
+            {
+                unique_lock<mutex> guard(CRITICAL_SECTION);
+                QUEUE_SIGNAL.wait(guard, [this] { return STOPPING.load() || !QUEUE.empty(); });
+                if (QUEUE.empty()) {
+                    return;
+                }
+                // A large request runs alone, small ones are drained together in one wake up
+                batch.push_back(QUEUE.front());
+                QUEUE.pop_front();
+                while (batch.front()->payload.size() <= DAEMON_SMALL_REQUEST && batch.size() < DAEMON_BATCH_MAX &&
+                       !QUEUE.empty() && QUEUE.front()->payload.size() <= DAEMON_SMALL_REQUEST) {
+                    batch.push_back(QUEUE.front());
+                    QUEUE.pop_front();
+                }
+            }
+            STATS.RecordBatch(batch.size());
+
+            for (DaemonRequest *request: batch) {
+                Process(*request);
+                uint64_t micros = uint64_t(chrono::duration_cast<chrono::microseconds>(
+                        chrono::steady_clock::now() - request->received).count());
+                STATS.Record(micros);
+                DaemonConnection *connection = request->connection;
+                connection->writeFailed = !WriteFrame(connection->fd, request->status, request->response,
+                                                      DAEMON_SEND_TIMEOUT_MILLIS);
+                if (request->operation == DAEMON_SHUTDOWN) {
+                    STOPPING = true;
+                }
+                {
+                    lock_guard<mutex> guard(CRITICAL_SECTION);
+                    ANSWERED.push_back(connection);
+                }
+                Wake();
+            }
+        }
+    }
+
+    /**
+     * Process() Run a single request
+     * @param request DaemonRequest
+     */
+    void Process(DaemonRequest &request) {
+        request.status = DAEMON_OK;
+        request.response.clear();
+        switch (request.operation) {
+            case DAEMON_COMPRESS:
+                Compress(request.payload, request.response);
+                break;
+            case DAEMON_DECOMPRESS: {
+                istringstream input(request.payload);
+                HuffmanStreamDecoder decoder(input);
+                string block;
+                while (decoder.DecodeNext(block)) {
+                    request.response += block;
+                }
+                if (!decoder.IsValid()) {
+                    request.status = DAEMON_ERROR;
+                    request.response = "Corrupt Or Truncated Stream";
+                }
+                break;
+            }
+            case DAEMON_STATS:
+                request.response = STATS.Report();
+                break;
+            case DAEMON_SHUTDOWN:
+                break;
+            default:
+                request.status = DAEMON_ERROR;
+                request.response = "Unknown Operation";
+        }
+    }
+
+    /**
+     * Compress() Encode a payload as a complete stream, one codebook per block of at most DEFAULT_REBUILD_INTERVAL
+     * @param payload String Input
+     * @param output String Output
+     */
+    static void Compress(const string &payload, string &output) {
+        const unsigned char *data = reinterpret_cast<const unsigned char *>(payload.data());
+        AppendStreamHeader(output);
+        for (size_t offset = 0; offset < payload.size(); offset += DEFAULT_REBUILD_INTERVAL) {
+            size_t size = min(DEFAULT_REBUILD_INTERVAL, payload.size() - offset);
+            AppendStandaloneBlock(data + offset, size, output);
+        }
+        AppendStreamEnd(output);
+    }
+};
+
+/**
+ * @class HuffmanDaemonClient . Loopback client for HuffmanDaemon.
+ */
+class HuffmanDaemonClient {
+public:
+    /**
+     * Connect() Connect to a daemon socket
+     * @param socketPath String Unix Socket Path
+     * @return Boolean Condition
+     */
+    bool Connect(const string &socketPath) {
+        struct sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (socketPath.size() >= sizeof(address.sun_path)) {
+            return false;
+        }
+        strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+        SOCKET_FD = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        return SOCKET_FD >= 0 &&
+               connect(SOCKET_FD, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) == 0;
+    }
+
+    /**
+     * Call() Send one request and wait for its response
+     * @param operation DaemonOperation
+     * @param payload String Request Payload
+     * @param response String Response Payload, Output
+     * @return Boolean Condition, true when the daemon answered DAEMON_OK
+     */
+    bool Call(DaemonOperation operation, const string &payload, string &response) {
+        uint8_t status = DAEMON_ERROR;
+        return WriteFrame(SOCKET_FD, uint8_t(operation), payload) && ReadFrame(SOCKET_FD, status, response) &&
+               status == DAEMON_OK;
+    }
+
+    /**
+     * ~HuffmanDaemonClient() Destructor, closes the connection
+     */
+    ~HuffmanDaemonClient() {
+        if (SOCKET_FD >= 0) {
+            close(SOCKET_FD);
+        }
+    }
+
+private:
+    // Connected Socket
+    int SOCKET_FD = -1;
+};
+
+#endif //EKHUFFMANPROJECT_HUFFMANDAEMON_H
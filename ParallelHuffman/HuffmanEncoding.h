@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <future>
 #include <iomanip>
+#include "HuffmanTreeBuilder.h"
 
 using namespace std;
 
@@ -38,7 +39,7 @@ public:
     /**
      * HuffmanEncoding() Default constructor to create instance of HuffmanEncoding
      * @param input1 String Data
-     * @param threshold Integer Threshold
+     * @param threshold Integer Threshold, number of bytes below which counting and encoding stop forking
      */
     HuffmanEncoding(const string &input1, const int threshold = 4) : WORD_DATA(input1), THRESHOLD(threshold) {
 
@@ -73,10 +74,24 @@ public:
      * GenerateLetterTable() Constructs a Letter or Frequency Table
      */
     void GenerateLetterTable() {
-        // Count Frequencies of Character
-        CountFrequencies(0, WORD_DATA.size());
-        // Sort Ascending By Counts
-        sort(LETTER_TABLE.begin(), LETTER_TABLE.end(), conditionCheck);
+        // Count Frequencies of Character, per-thread tables summed together. Slices of THRESHOLD bytes or less are
+        // never split, a smaller threshold still gets one slice per hardware thread rather than a thread per letter
+        size_t sliceBytes = max(MIN_PARALLEL_COUNT, WORD_DATA.size() / max(1u, thread::hardware_concurrency()));
+        sliceBytes = max(sliceBytes, size_t(max(THRESHOLD, 0)));
+        uint64_t counts[TREE_SYMBOLS];
+        HuffmanTreeBuilder::CountHistogram(reinterpret_cast<const unsigned char *>(WORD_DATA.data()),
+                                           WORD_DATA.size(), counts, sliceBytes);
+        // Sort Ascending By Counts, equal counts by symbol, on (count, symbol) integer pairs
+        uint64_t pairs[TREE_SYMBOLS];
+        int numPairs = HuffmanTreeBuilder::SortedPairs(counts, pairs);
+
+        LETTER_TABLE.clear();
+        for (int i = 0; i < numPairs; i++) {
+            CharacterTypeInfo newLetter;
+            newLetter.symbol = char(pairs[i] & 0xFF);
+            newLetter.count = int(pairs[i] >> 8);
+            LETTER_TABLE.push_back(newLetter);
+        }
     }
 
     /**
@@ -88,6 +103,15 @@ public:
 
         // Start on Clean Slate
         HUFFMAN_TREE_NODES.clear();
+        if (totalSize < 2) {
+            if (totalSize == 1) {
+                // A Lone Letter hangs off both sides of the root and gets a one bit code
+                IncreaseSize(1);
+                HUFFMAN_TREE_NODES[0].left = HUFFMAN_TREE_NODES[0].right = &LETTER_TABLE[0];
+                LETTER_TABLE[0].codeword = "0";
+            }
+            return;
+        }
         // Resize Huffman Tree Interior Nodes
         IncreaseSize((totalSize - 1));
 
@@ -113,7 +137,7 @@ public:
      */
     void DecodeWord(string input1, string &output) {
         // Write Output, decompressed result
-        output = GetLetters(&HUFFMAN_TREE_NODES[0], input1);
+        output = HUFFMAN_TREE_NODES.empty() ? "" : GetLetters(&HUFFMAN_TREE_NODES[0], input1);
     }
 
     /**
@@ -134,57 +158,6 @@ private:
     vector<CharacterTypeInfo> HUFFMAN_TREE_NODES;
     // Threshold Limit
     int THRESHOLD;
-    // Mutex Critical Section
-    mutex CRITICAL_SECTION;
-
-    /**
-     * CountFrequencies() Count Number of Duplicate Occurrences, Updates Frequency or Letter Table
-     * @param start Integer Starting Index
-     * @param end Integer End Index
-     * @return Boolean Condition
-     */
-    bool CountFrequencies(int start, int end) {
-        // Difference between start and end
-        int dif = (end - start);
-        if (dif > THRESHOLD) {
-            // Calculate Mid Point
-            int mid = (end + start) / 2;
-
-            // Left Thread Fork
-            auto leftForkThread = async(&HuffmanEncoding::CountFrequencies, this, start, mid);
-            // Right Frequencies in Second Half
-            CountFrequencies(mid, end);
-
-            // Wait for Left Fork Thread
-            leftForkThread.wait();
-            return true;
-        }
-
-        // Acquire Lock
-        CRITICAL_SECTION.lock();
-        for (int i = start; i < end; i++) {
-            // Get Character from WORD_DATA
-            char letter = WORD_DATA.at(i);
-            // Find This Letter, Looking for Duplicate
-            int index = FindCharacter(letter);
-            if (index == -1) {
-                // Does Not Exist. Create New CharacterTypeInfo data type
-                CharacterTypeInfo newLetter;
-                newLetter.symbol = letter;
-                newLetter.count = 1;
-                newLetter.codeword = "";
-                // Push Back
-                LETTER_TABLE.push_back(newLetter);
-            } else {
-                // Letter Exists, Increment The Count
-                LETTER_TABLE.at(index).count = LETTER_TABLE.at(index).count + 1;
-            }
-        }
-        // Release Lock
-        CRITICAL_SECTION.unlock();
-
-        return true;
-    }
 
     /**
      * WriteEncodes() Update Letter's codeword or encoded in the Letter/Frequency Table,
@@ -332,85 +305,41 @@ protected:
     }
 
     /**
-     * OptimalHuffmanTree() Construct a Huffman Tree
+     * OptimalHuffmanTree() Construct a Huffman Tree, two-queue method. Letters wait in the sorted Letter Table,
+     * interior nodes are created from the back of HUFFMAN_TREE_NODES towards the root at index 0, so both queues
+     * stay in ascending count order.
      * @param totalSize Integer Frequency/Letter Table Size
      */
     virtual void OptimalHuffmanTree(int totalSize) {
         // Index of letter Table
         int i = 0;
-        // For Huffman Tree
-        int p = totalSize - 2, k = p, l = k;
+        // Oldest interior node not yet used, and the next one to create
+        int head = totalSize - 2, p = totalSize - 2;
 
         while (p >= 0) {
-            if (i < LETTER_TABLE.size() - 1) {
-                if (p == k && k == l) {
-                    HUFFMAN_TREE_NODES.at(p).count = LETTER_TABLE.at(i).count + LETTER_TABLE.at((i + 1)).count;
-                    HUFFMAN_TREE_NODES.at(p).left = &LETTER_TABLE.at(i);
-                    HUFFMAN_TREE_NODES.at(p).right = &LETTER_TABLE.at((i + 1));
-
-                    p--;
-                    i += 2;
-                } else {
-                    // Check if L, count is greater Than I, count
-                    if (HUFFMAN_TREE_NODES.at(l).count > LETTER_TABLE.at(i).count) {
-                        // Insert Both I, and I + 1
-                        HUFFMAN_TREE_NODES.at(p).count = LETTER_TABLE.at(i).count + LETTER_TABLE.at((i + 1)).count;
-                        HUFFMAN_TREE_NODES.at(p).left = &LETTER_TABLE.at(i);
-                        HUFFMAN_TREE_NODES.at(p).right = &LETTER_TABLE.at((i + 1));
-
-                        p--;
-                        k--;
-                        i += 2;
-                    } else {
-                        // Insert Both I, and Interior Node Value
-                        HUFFMAN_TREE_NODES.at(p).count = LETTER_TABLE.at(i).count + HUFFMAN_TREE_NODES.at(l).count;
-                        HUFFMAN_TREE_NODES.at(p).left = &HUFFMAN_TREE_NODES.at(l);
-                        HUFFMAN_TREE_NODES.at(p).right = &LETTER_TABLE.at(i);
-
-                        p--;
-                        l--;
-                        k--;
-                        i++;
-                    }
-                }
-            } else if (i == LETTER_TABLE.size() - 1) {
-                // Insert Both I, and Interior Node Value
-                HUFFMAN_TREE_NODES.at(p).count = LETTER_TABLE.at(i).count + HUFFMAN_TREE_NODES.at(l).count;
-                HUFFMAN_TREE_NODES.at(p).left = &HUFFMAN_TREE_NODES.at(l);
-                HUFFMAN_TREE_NODES.at(p).right = &LETTER_TABLE.at(i);
-
-                if (HUFFMAN_TREE_NODES.at(l).count > LETTER_TABLE.at(i).count) {
-                    HUFFMAN_TREE_NODES.at(p).left = &LETTER_TABLE.at(i);
-                    HUFFMAN_TREE_NODES.at(p).right = &HUFFMAN_TREE_NODES.at(l);
-                }
-
-                p--;
-                l--;
-                k--;
-                i++;
-            } else {
-                // combine k and l
-                if (l >= k) {
-                    int sum = HUFFMAN_TREE_NODES.at(l).count + HUFFMAN_TREE_NODES.at((l - 1)).count;
-                    // Insert Both I, and Interior Node Value
-                    HUFFMAN_TREE_NODES.at(p).count = sum;
-                    HUFFMAN_TREE_NODES.at(p).left = &HUFFMAN_TREE_NODES.at(l);
-                    HUFFMAN_TREE_NODES.at(p).right = &HUFFMAN_TREE_NODES.at((l - 1));
-
-                    if (HUFFMAN_TREE_NODES.at(l).count > HUFFMAN_TREE_NODES.at((l - 1)).count) {
-                        HUFFMAN_TREE_NODES.at(p).left = &HUFFMAN_TREE_NODES.at((l - 1));
-
-                        HUFFMAN_TREE_NODES.at(p).right = &HUFFMAN_TREE_NODES.at(l);
-                    }
-
-                    p--;
-                    l -= 2;
-                    k--;
-                }
-
-            }
+            CharacterTypeInfo *first = TakeLowest(i, head, p);
+            CharacterTypeInfo *second = TakeLowest(i, head, p);
+            HUFFMAN_TREE_NODES.at(p).count = first->count + second->count;
+            HUFFMAN_TREE_NODES.at(p).left = first;
+            HUFFMAN_TREE_NODES.at(p).right = second;
+            p--;
+        }
+    }
 
+    /**
+     * TakeLowest() Pop the lighter of the next letter and the oldest interior node, letters win ties
+     * @param letterIndex Integer Next Letter, advanced
+     * @param interiorHead Integer Oldest Unused Interior Node, advanced
+     * @param nextInterior Integer Interior Node being created, interior queue holds nextInterior+1..interiorHead
+     * @return CharacterTypeInfo Node
+     */
+    CharacterTypeInfo *TakeLowest(int &letterIndex, int &interiorHead, int nextInterior) {
+        bool interiorReady = interiorHead > nextInterior;
+        if (letterIndex < LETTER_TABLE.size() &&
+            (!interiorReady || LETTER_TABLE.at(letterIndex).count <= HUFFMAN_TREE_NODES.at(interiorHead).count)) {
+            return &LETTER_TABLE.at(letterIndex++);
         }
+        return &HUFFMAN_TREE_NODES.at(interiorHead--);
     }
 
     /**
@@ -420,7 +349,7 @@ protected:
      * @return String Encoding
      */
     string GetLetterEncode(int root, char letter) {
-        while (root < LETTER_TABLE.size() / 2) {
+        while (root <= LETTER_TABLE.size() / 2) {
             // Get Left and Right Index
             int rightI = rightIndex(root);
             int leftI = leftIndex(root);
@@ -5,12 +5,27 @@
  *
  * Starting Point for Huffman Encoding
  */
+#include <cerrno>
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <cstdlib>
+#include <poll.h>
+#include <unistd.h>
 #include "RandomWordGenerator.h"
 #include "HuffmanEncoding.h"
+#include "AdaptiveHuffmanStream.h"
+#include "AsyncBlockCompressor.h"
+#include "SharedCodebookEncoder.h"
+#include "HuffmanDaemon.h"
 
 using namespace std;
 
+// A partial block is flushed once standard input has been quiet this long
+const int STREAM_IDLE_MILLIS = 50;
+// ... or once its oldest byte has waited this long, for inputs that trickle without pause
+const int STREAM_MAX_DELAY_MILLIS = 500;
+
 /**
  * InterfaceEncoding() Print Messages
  * @param input String Input
@@ -49,11 +64,310 @@ void InterfaceEncoding(const string& input)
     cout << "\n--------------------------------End----------------------------------------\n";
 }
 
+/**
+ * StreamEncode() Encode standard input to standard output as it arrives. A partial block is flushed when the input
+ * goes idle or its first byte has waited STREAM_MAX_DELAY_MILLIS, not after every short read, so a log written one
+ * line at a time still fills blocks
+ * @param rebuildInterval Number of Bytes between codebook rebuilds
+ * @param checksums Boolean Condition, give every block a CRC32C
+ * @return Integer Exit Status
+ */
+int StreamEncode(size_t rebuildInterval, bool checksums) {
+    HuffmanStreamEncoder encoder(cout, rebuildInterval, checksums);
+    char chunk[4096];
+    bool pending = false;
+    chrono::steady_clock::time_point firstPending, lastArrival;
+    while (true) {
+        int timeout = -1;
+        if (pending) {
+            chrono::steady_clock::time_point deadline =
+                    min(lastArrival + chrono::milliseconds(STREAM_IDLE_MILLIS),
+                        firstPending + chrono::milliseconds(STREAM_MAX_DELAY_MILLIS));
+            timeout = int(max<int64_t>(0, chrono::duration_cast<chrono::milliseconds>(
+                    deadline - chrono::steady_clock::now()).count()));
+        }
+        struct pollfd watched = {STDIN_FILENO, POLLIN, 0};
+        int ready = poll(&watched, 1, timeout);
+        if (ready == 0) {
+            encoder.Flush();
+            pending = false;
+            continue;
+        }
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        ssize_t got = ready < 0 ? -1 : read(STDIN_FILENO, chunk, sizeof(chunk));
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got < 0) {
+            // The stream written so far stays decodable, but the caller must learn the input was cut short
+            cerr << "Cannot Read Input: " << strerror(errno) << "\n";
+            encoder.Finish();
+            return 1;
+        }
+        if (got == 0) {
+            break;
+        }
+        encoder.Write(chunk, size_t(got));
+        lastArrival = chrono::steady_clock::now();
+        if (!pending) {
+            firstPending = lastArrival;
+            pending = true;
+        }
+    }
+    encoder.Finish();
+    return 0;
+}
+
+/**
+ * ClusterEncode() Encode all of standard input with shared codebooks, each block picking the cheapest
+ * @param argc Integer Argument Count
+ * @param argv Arguments, "[K] [--block KB] [--checksum]"
+ * @return Integer Exit Status
+ */
+int ClusterEncode(int argc, char *argv[]) {
+    int numCodebooks = DEFAULT_SHARED_CODEBOOKS;
+    size_t blockSize = DEFAULT_SHARED_BLOCK;
+    bool checksums = false;
+    for (int i = 0; i < argc; i++) {
+        string option = argv[i];
+        if (option == "--block" && i + 1 < argc) {
+            blockSize = strtoul(argv[++i], nullptr, 10) * 1024;
+        } else if (option == "--checksum") {
+            checksums = true;
+        } else {
+            numCodebooks = atoi(argv[i]);
+        }
+    }
+
+    // Clustering needs every block up front
+    string input, output;
+    char chunk[1 << 16];
+    ssize_t got;
+    while ((got = read(STDIN_FILENO, chunk, sizeof(chunk))) > 0) {
+        input.append(chunk, size_t(got));
+    }
+    SharedCodebookEncoder encoder(numCodebooks, blockSize, checksums);
+    encoder.Encode(reinterpret_cast<const unsigned char *>(input.data()), input.size(), output);
+    cout.write(output.data(), output.size());
+    cerr << "Shared Codebooks: " << encoder.NumSharedCodebooks() << ", Blocks With Their Own: "
+         << encoder.NumOwnCodebooks() << "\n";
+    return 0;
+}
+
+/**
+ * StreamDecode() Decode standard input to standard output, block by block
+ * @return Integer Exit Status
+ */
+int StreamDecode() {
+    HuffmanStreamDecoder decoder(cin);
+    string block;
+    while (decoder.DecodeNext(block)) {
+        cout.write(block.data(), block.size());
+        cout.flush();
+    }
+    if (decoder.HasChecksumMismatch()) {
+        cerr << "Block Checksum Mismatch\n";
+        return 1;
+    }
+    if (!decoder.IsValid()) {
+        cerr << "Corrupt Or Truncated Stream\n";
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * CompressFiles() Compress files with overlapped I/O
+ * @param argc Integer Argument Count
+ * @param argv Arguments, "[--depth N] [--block KB] [--threads-io] [--checksum] files..."
+ * @return Integer Exit Status
+ */
+int CompressFiles(int argc, char *argv[]) {
+    unsigned depth = DEFAULT_QUEUE_DEPTH;
+    size_t blockSize = DEFAULT_COMPRESS_BLOCK;
+    bool preferThreads = false, checksums = false;
+    vector<string> paths;
+    for (int i = 0; i < argc; i++) {
+        string option = argv[i];
+        if (option == "--depth" && i + 1 < argc) {
+            depth = unsigned(strtoul(argv[++i], nullptr, 10));
+        } else if (option == "--block" && i + 1 < argc) {
+            blockSize = strtoul(argv[++i], nullptr, 10) * 1024;
+        } else if (option == "--threads-io") {
+            preferThreads = true;
+        } else if (option == "--checksum") {
+            checksums = true;
+        } else {
+            paths.push_back(option);
+        }
+    }
+
+    AsyncBlockCompressor compressor(blockSize, depth, preferThreads, checksums);
+    CompressionSummary summary = compressor.CompressFiles(paths);
+
+    double megabytes = double(summary.bytesIn) / (1024.0 * 1024.0);
+    cout << "Backend: " << summary.backend << "\n";
+    if (!summary.checksum.empty()) {
+        cout << "Checksums: CRC32C (" << summary.checksum << ")\n";
+    }
+    cout << "Files Compressed: " << summary.filesDone << ", Failed: " << summary.filesFailed << "\n"
+         << "Bytes In: " << summary.bytesIn << ", Bytes Out: " << summary.bytesOut << "\n"
+         << "Seconds: " << summary.seconds << ", MB/s: " << (summary.seconds > 0 ? megabytes / summary.seconds : 0)
+         << "\n";
+    return summary.filesFailed == 0 ? 0 : 1;
+}
+
+/**
+ * RunDaemon() Serve compression requests on a Unix socket
+ * @param argc Integer Argument Count
+ * @param argv Arguments, "<socket> [--workers N]"
+ * @return Integer Exit Status
+ */
+int RunDaemon(int argc, char *argv[]) {
+    if (argc < 1) {
+        cerr << "Missing Socket Path\n";
+        return 1;
+    }
+    int workers = int(thread::hardware_concurrency());
+    if (argc > 2 && string(argv[1]) == "--workers") {
+        workers = atoi(argv[2]);
+    }
+    HuffmanDaemon daemon(argv[0], workers);
+    if (!daemon.Run()) {
+        cerr << "Could Not Listen On: " << argv[0] << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * BenchDaemon() Hammer a daemon with small compress requests from several client threads, then print its stats
+ * @param socketPath String Unix Socket Path
+ * @param sample String Request Data, cut into requests of at most 4 KB
+ * @param numClients Integer Number of Client Threads
+ * @param numRequests Integer Requests per Client
+ * @return Integer Exit Status
+ */
+int BenchDaemon(const string &socketPath, const string &sample, int numClients, int numRequests) {
+    const size_t REQUEST_SIZE = 4096;
+    atomic<int> failures(0);
+    vector<thread> clients;
+    for (int c = 0; c < numClients; c++) {
+        clients.push_back(thread([&, c]() {
+            HuffmanDaemonClient client;
+            if (!client.Connect(socketPath)) {
+                failures++;
+                return;
+            }
+            string compressed, restored;
+            for (int r = 0; r < numRequests; r++) {
+                size_t offset = sample.empty() ? 0 : (size_t(c) * 7919 + size_t(r) * REQUEST_SIZE) % sample.size();
+                string payload = sample.substr(offset, REQUEST_SIZE);
+                if (!client.Call(DAEMON_COMPRESS, payload, compressed) ||
+                    !client.Call(DAEMON_DECOMPRESS, compressed, restored) || restored != payload) {
+                    failures++;
+                }
+            }
+        }));
+    }
+    for (thread &client: clients) {
+        client.join();
+    }
+
+    HuffmanDaemonClient client;
+    string report;
+    if (!client.Connect(socketPath) || !client.Call(DAEMON_STATS, "", report)) {
+        cerr << "Could Not Reach Daemon\n";
+        return 1;
+    }
+    cout << report << "failures " << failures.load() << "\n";
+    return failures.load() == 0 ? 0 : 1;
+}
+
+/**
+ * DaemonClient() Loopback client, "compress" and "decompress" map standard input to standard output
+ * @param argc Integer Argument Count
+ * @param argv Arguments, "<socket> compress|decompress|stats|shutdown" or "<socket> bench [clients] [requests]"
+ * @return Integer Exit Status
+ */
+int DaemonClient(int argc, char *argv[]) {
+    if (argc < 2) {
+        cerr << "Usage: --client <socket> compress|decompress|stats|shutdown|bench\n";
+        return 1;
+    }
+    string socketPath = argv[0], command = argv[1];
+    string input;
+    if (command == "compress" || command == "decompress" || command == "bench") {
+        ostringstream buffer;
+        buffer << cin.rdbuf();
+        input = buffer.str();
+    }
+    if (command == "bench") {
+        return BenchDaemon(socketPath, input, argc > 2 ? atoi(argv[2]) : 8, argc > 3 ? atoi(argv[3]) : 1000);
+    }
+
+    DaemonOperation operation = DAEMON_STATS;
+    if (command == "compress") {
+        operation = DAEMON_COMPRESS;
+    } else if (command == "decompress") {
+        operation = DAEMON_DECOMPRESS;
+    } else if (command == "shutdown") {
+        operation = DAEMON_SHUTDOWN;
+    }
+
+    HuffmanDaemonClient client;
+    string response;
+    if (!client.Connect(socketPath)) {
+        cerr << "Could Not Connect To: " << socketPath << "\n";
+        return 1;
+    }
+    bool success = client.Call(operation, input, response);
+    (success ? cout : cerr) << response;
+    return success ? 0 : 1;
+}
+
 /**
  * main() Entry Point or Starting Point
+ * @param argc Integer Argument Count
+ * @param argv Arguments, "--stream-encode [KB] [--checksum]", "--cluster-encode ...", "--stream-decode",
+ * "--compress ...", "--daemon ..." or "--client ...", none runs the demo
  * @return
  */
-int main() {
+int main(int argc, char *argv[]) {
+    if (argc > 1) {
+        string mode = argv[1];
+        if (mode == "--stream-encode") {
+            size_t intervalKB = DEFAULT_REBUILD_INTERVAL / 1024;
+            bool checksums = false;
+            for (int i = 2; i < argc; i++) {
+                if (string(argv[i]) == "--checksum") {
+                    checksums = true;
+                } else {
+                    intervalKB = strtoul(argv[i], nullptr, 10);
+                }
+            }
+            return StreamEncode(intervalKB * 1024, checksums);
+        }
+        if (mode == "--cluster-encode") {
+            return ClusterEncode(argc - 2, argv + 2);
+        }
+        if (mode == "--stream-decode") {
+            return StreamDecode();
+        }
+        if (mode == "--compress") {
+            return CompressFiles(argc - 2, argv + 2);
+        }
+        if (mode == "--daemon") {
+            return RunDaemon(argc - 2, argv + 2);
+        }
+        if (mode == "--client") {
+            return DaemonClient(argc - 2, argv + 2);
+        }
+        cerr << "Unknown Mode: " << mode << "\n";
+        return 1;
+    }
 
     const int MINIMUM_CHARACTERS = 20; // Will be Higher to Added spaces between
     const string TEST_WORD = "What if the confident courage ate the win?";
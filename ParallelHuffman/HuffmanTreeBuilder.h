@@ -0,0 +1,188 @@
+/**
+ * @file : HuffmanTreeBuilder.h
+ * @author : Edwin Kaburu
+ * @date : 10/18/2026
+ *
+ * Allocation free Huffman tree stage working on (count, symbol) integer pairs. Per-thread byte histograms are
+ * merged by summation, pairs are radix sorted, and the tree is built with the linear two-queue method. Ties are
+ * always broken by symbol value and leaves win over interior nodes of equal count, so the resulting code does
+ * not depend on the number of threads.
+ */
+#ifndef EKHUFFMANPROJECT_HUFFMANTREEBUILDER_H
+#define EKHUFFMANPROJECT_HUFFMANTREEBUILDER_H
+
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <thread>
+#include <algorithm>
+
+using namespace std;
+
+// Number of distinct byte symbols
+const int TREE_SYMBOLS = 256;
+// Smallest slice worth a thread of its own when counting
+const size_t MIN_PARALLEL_COUNT = 64 * 1024;
+
+/**
+ * @class HuffmanTreeBuilder . Histogram merge, counting sort and two-queue construction over fixed arrays.
+ */
+class HuffmanTreeBuilder {
+public:
+    /**
+     * CountHistogram() Count byte values, forking halves onto threads and summing their tables
+     * @param data Byte Pointer
+     * @param size Number of Bytes
+     * @param counts Array of TREE_SYMBOLS Counts, Output
+     * @param threshold Number of Bytes below which a slice is counted on the calling thread, zero picks one slice
+     * per hardware thread
+     */
+    static void CountHistogram(const unsigned char *data, size_t size, uint64_t counts[TREE_SYMBOLS],
+                               size_t threshold = 0) {
+        memset(counts, 0, sizeof(uint64_t) * TREE_SYMBOLS);
+        if (threshold == 0) {
+            threshold = max(MIN_PARALLEL_COUNT, size / max(1u, thread::hardware_concurrency()));
+        }
+        if (size > max(threshold, size_t(1))) {
+            // Left Thread Fork
+            size_t mid = size / 2;
+            uint64_t leftCounts[TREE_SYMBOLS];
+            auto leftFork = async(launch::async, &HuffmanTreeBuilder::CountHistogram, data, mid, leftCounts,
+                                  threshold);
+            // Right Half on this Thread
+            CountHistogram(data + mid, size - mid, counts, threshold);
+            leftFork.wait();
+            // Merge, sums do not depend on how the input was split
+            for (int s = 0; s < TREE_SYMBOLS; s++) {
+                counts[s] += leftCounts[s];
+            }
+            return;
+        }
+
+        // Four interleaved tables so repeated bytes do not serialize on one counter
+        uint64_t lanes[4][TREE_SYMBOLS];
+        memset(lanes, 0, sizeof(lanes));
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4) {
+            lanes[0][data[i]]++;
+            lanes[1][data[i + 1]]++;
+            lanes[2][data[i + 2]]++;
+            lanes[3][data[i + 3]]++;
+        }
+        for (; i < size; i++) {
+            lanes[0][data[i]]++;
+        }
+        for (int s = 0; s < TREE_SYMBOLS; s++) {
+            counts[s] = lanes[0][s] + lanes[1][s] + lanes[2][s] + lanes[3][s];
+        }
+    }
+
+    /**
+     * SortedPairs() Non-zero (count, symbol) pairs in ascending count order, equal counts by ascending symbol
+     * @param counts Array of TREE_SYMBOLS Counts
+     * @param pairs Array of TREE_SYMBOLS Keys, Output, each (count << 8) | symbol
+     * @return Integer Number of Pairs
+     */
+    static int SortedPairs(const uint64_t counts[TREE_SYMBOLS], uint64_t pairs[TREE_SYMBOLS]) {
+        uint64_t scratch[TREE_SYMBOLS];
+        int n = 0;
+        uint64_t largest = 0;
+        // Symbol order first, the stable passes below keep it among equal counts
+        for (int s = 0; s < TREE_SYMBOLS; s++) {
+            if (counts[s] > 0) {
+                uint64_t count = min(counts[s], (uint64_t(1) << 56) - 1);
+                pairs[n++] = (count << 8) | uint64_t(s);
+                largest = max(largest, count);
+            }
+        }
+
+        // LSD counting sort, one byte of the count per pass, only as many passes as the largest count needs
+        uint64_t *from = pairs, *to = scratch;
+        for (int shift = 8; shift < 64 && (largest >> (shift - 8)) > 0; shift += 8) {
+            int buckets[TREE_SYMBOLS + 1];
+            memset(buckets, 0, sizeof(buckets));
+            for (int i = 0; i < n; i++) {
+                buckets[((from[i] >> shift) & 0xFF) + 1]++;
+            }
+            for (int b = 0; b < TREE_SYMBOLS; b++) {
+                buckets[b + 1] += buckets[b];
+            }
+            for (int i = 0; i < n; i++) {
+                to[buckets[(from[i] >> shift) & 0xFF]++] = from[i];
+            }
+            swap(from, to);
+        }
+        if (from != pairs) {
+            copy(from, from + n, pairs);
+        }
+        return n;
+    }
+
+    /**
+     * BuildLengths() Huffman codeword lengths from counts, two-queue construction on sorted pairs
+     * @param counts Array of TREE_SYMBOLS Counts
+     * @param lengths Array of TREE_SYMBOLS Lengths, Output, zero for absent symbols, saturates at 255
+     * @return Integer Longest Length, zero when every count is zero
+     */
+    static int BuildLengths(const uint64_t counts[TREE_SYMBOLS], uint8_t lengths[TREE_SYMBOLS]) {
+        memset(lengths, 0, TREE_SYMBOLS);
+        uint64_t pairs[TREE_SYMBOLS];
+        int n = SortedPairs(counts, pairs);
+        if (n == 0) {
+            return 0;
+        }
+        if (n == 1) {
+            // A Lone Symbol still needs a one bit codeword
+            lengths[pairs[0] & 0xFF] = 1;
+            return 1;
+        }
+
+        // Leaves are 0..n-1 in sorted order, interior nodes n..2n-2 in creation order, which is also count order
+        uint64_t weight[2 * TREE_SYMBOLS];
+        int parent[2 * TREE_SYMBOLS];
+        for (int i = 0; i < n; i++) {
+            weight[i] = pairs[i] >> 8;
+        }
+        int leaf = 0, interior = n, next = n;
+        while (next < 2 * n - 1) {
+            int first = TakeLowest(weight, n, leaf, interior, next);
+            int second = TakeLowest(weight, n, leaf, interior, next);
+            weight[next] = weight[first] + weight[second];
+            parent[first] = parent[second] = next;
+            next++;
+        }
+
+        // Depths from the root down, a parent always has a larger index than its children
+        int depth[2 * TREE_SYMBOLS];
+        int root = 2 * n - 2;
+        depth[root] = 0;
+        for (int node = root - 1; node >= 0; node--) {
+            depth[node] = depth[parent[node]] + 1;
+        }
+        int maxLength = 0;
+        for (int i = 0; i < n; i++) {
+            lengths[pairs[i] & 0xFF] = uint8_t(min(depth[i], 255));
+            maxLength = max(maxLength, depth[i]);
+        }
+        return maxLength;
+    }
+
+private:
+    /**
+     * TakeLowest() Pop the lighter head of the leaf queue and the interior queue, leaves win ties
+     * @param weight Node Weights
+     * @param n Integer Number of Leaves
+     * @param leaf Integer Leaf Queue Head, advanced
+     * @param interior Integer Interior Queue Head, advanced
+     * @param next Integer Next Interior Node to be created, interior queue holds interior..next-1
+     * @return Integer Node Index
+     */
+    static int TakeLowest(const uint64_t weight[], int n, int &leaf, int &interior, int next) {
+        if (leaf < n && (interior == next || weight[leaf] <= weight[interior])) {
+            return leaf++;
+        }
+        return interior++;
+    }
+};
+
+#endif //EKHUFFMANPROJECT_HUFFMANTREEBUILDER_H
@@ -0,0 +1,286 @@
+/**
+ * @file : SharedCodebookEncoder.h
+ * @author : Edwin Kaburu
+ * @date : 10/18/2026
+ *
+ * Block coding with a few shared codebooks. The histograms of every block are clustered into K groups, each group
+ * gets one codebook sent once in the stream header, and each block is coded with whichever codebook gives it the
+ * fewest bits, storing a one byte id instead of 256 code lengths. Output decodes with HuffmanStreamDecoder.
+ */
+#ifndef EKHUFFMANPROJECT_SHAREDCODEBOOKENCODER_H
+#define EKHUFFMANPROJECT_SHAREDCODEBOOKENCODER_H
+
+#include <string>
+#include <vector>
+#include "AdaptiveHuffmanStream.h"
+
+using namespace std;
+
+// Default Number of Shared Codebooks
+const int DEFAULT_SHARED_CODEBOOKS = 8;
+// Most Shared Codebooks, ids are one byte
+const int MAX_SHARED_CODEBOOKS = 255;
+// Default Block Size, small blocks follow changes in the data closely once their codebooks are shared
+const size_t DEFAULT_SHARED_BLOCK = 16 * 1024;
+// Most Rounds of reassigning blocks and rebuilding codebooks
+const int CLUSTER_ROUNDS = 10;
+// Most Blocks the clustering looks at, evenly spread over the input, every block is still priced when choosing
+const size_t CLUSTER_SAMPLE_BLOCKS = 256;
+
+/**
+ * @class SharedCodebookEncoder . Clusters block histograms into shared codebooks, then codes every block.
+ */
+class SharedCodebookEncoder {
+public:
+    /**
+     * SharedCodebookEncoder() Constructor To Create Instance of SharedCodebookEncoder
+     * @param numCodebooks Number of Shared Codebooks, at most MAX_SHARED_CODEBOOKS
+     * @param blockSize Number of Bytes per Block
+     * @param checksums Boolean Condition, give every block a CRC32C
+     */
+    SharedCodebookEncoder(int numCodebooks = DEFAULT_SHARED_CODEBOOKS, size_t blockSize = DEFAULT_SHARED_BLOCK,
+                          bool checksums = false)
+            : MAX_CODEBOOKS(max(1, min(numCodebooks, MAX_SHARED_CODEBOOKS))),
+              BLOCK_BYTES(blockSize > 0 ? min(blockSize, MAX_STREAM_BLOCK) : DEFAULT_SHARED_BLOCK),
+              CHECKSUMS(checksums) {
+
+    }
+
+    /**
+     * Encode() Encode data as one complete stream
+     * @param data Byte Pointer
+     * @param size Number of Bytes
+     * @param output String Output, the stream is appended
+     */
+    void Encode(const unsigned char *data, size_t size, string &output) {
+        CountBlocks(data, size);
+        ClusterBlocks();
+        ChooseCodebooks();
+
+        if (CODEBOOKS.empty()) {
+            AppendStreamHeader(output, CHECKSUMS);
+        } else {
+            AppendSharedStreamHeader(output, CODEBOOKS, CHECKSUMS);
+        }
+        for (size_t b = 0; b < NumBlocks(); b++) {
+            const unsigned char *blockData = data + b * BLOCK_BYTES;
+            size_t blockSize = min(BLOCK_BYTES, size - b * BLOCK_BYTES);
+            if (CHOICES[b] >= 0) {
+                AppendSharedBlock(CODEBOOKS[CHOICES[b]], uint8_t(CHOICES[b]), blockData, blockSize, output,
+                                  CHECKSUMS);
+            } else {
+                // Same block AppendStandaloneBlock() writes, from the counts already taken
+                HuffmanCodebook own;
+                bool hasSymbols = own.BuildFromCounts(BLOCK_COUNTS[b].counts);
+                AppendStreamBlock(own, hasSymbols, blockData, blockSize, output, CHECKSUMS);
+            }
+        }
+        AppendStreamEnd(output);
+    }
+
+    /**
+     * NumSharedCodebooks() Number of codebooks sent in the header of the last stream
+     * @return Integer Count
+     */
+    int NumSharedCodebooks() const {
+        return int(CODEBOOKS.size());
+    }
+
+    /**
+     * NumOwnCodebooks() Number of blocks of the last stream that were cheaper with a codebook of their own
+     * @return Integer Count
+     */
+    int NumOwnCodebooks() const {
+        int own = 0;
+        for (int choice: CHOICES) {
+            own += choice < 0 ? 1 : 0;
+        }
+        return own;
+    }
+
+private:
+    /**
+     * @struct Byte counts of one block
+     */
+    struct BlockCounts {
+        uint64_t counts[SYMBOL_COUNT];
+    };
+
+    // Most Shared Codebooks
+    int MAX_CODEBOOKS;
+    // Bytes per Block
+    size_t BLOCK_BYTES;
+    // Blocks carry a CRC32C
+    bool CHECKSUMS;
+    // Counts of every Block
+    vector<BlockCounts> BLOCK_COUNTS;
+    // Symbols found anywhere in the Input
+    bool PRESENT[SYMBOL_COUNT];
+    // Bits of every Block coded with its own codebook, the codebook itself included
+    vector<uint64_t> OWN_BITS;
+    // Shared Codebooks
+    vector<HuffmanCodebook> CODEBOOKS;
+    // Codebook of every Block, -1 for its own
+    vector<int> CHOICES;
+
+    /**
+     * NumBlocks() Number of blocks of the current input
+     * @return Number of Blocks
+     */
+    size_t NumBlocks() const {
+        return BLOCK_COUNTS.size();
+    }
+
+    /**
+     * CountBlocks() Count every block and price it with a codebook of its own
+     * @param data Byte Pointer
+     * @param size Number of Bytes
+     */
+    void CountBlocks(const unsigned char *data, size_t size) {
+        size_t numBlocks = (size + BLOCK_BYTES - 1) / BLOCK_BYTES;
+        BLOCK_COUNTS.assign(numBlocks, BlockCounts());
+        OWN_BITS.assign(numBlocks, 0);
+        memset(PRESENT, 0, sizeof(PRESENT));
+        for (size_t b = 0; b < numBlocks; b++) {
+            uint64_t *counts = BLOCK_COUNTS[b].counts;
+            HuffmanTreeBuilder::CountHistogram(data + b * BLOCK_BYTES, min(BLOCK_BYTES, size - b * BLOCK_BYTES),
+                                               counts);
+            // Plain Huffman lengths price the block exactly unless they need limiting, only then build the codebook
+            uint8_t lengths[SYMBOL_COUNT];
+            if (HuffmanTreeBuilder::BuildLengths(counts, lengths) <= MAX_CODE_LENGTH) {
+                OWN_BITS[b] = SYMBOL_COUNT * 8;
+                for (int s = 0; s < SYMBOL_COUNT; s++) {
+                    OWN_BITS[b] += counts[s] * lengths[s];
+                }
+            } else {
+                HuffmanCodebook own;
+                own.BuildFromCounts(counts);
+                OWN_BITS[b] = own.EstimateBits(counts) + SYMBOL_COUNT * 8;
+            }
+            for (int s = 0; s < SYMBOL_COUNT; s++) {
+                PRESENT[s] = PRESENT[s] || counts[s] > 0;
+            }
+        }
+    }
+
+    /**
+     * BuildShared() Build a shared codebook from counts, giving every symbol of the input a codeword so any block
+     * can use it
+     * @param counts Array of SYMBOL_COUNT Counts
+     * @param codebook HuffmanCodebook Output
+     */
+    void BuildShared(const uint64_t counts[SYMBOL_COUNT], HuffmanCodebook &codebook) const {
+        uint64_t smoothed[SYMBOL_COUNT];
+        for (int s = 0; s < SYMBOL_COUNT; s++) {
+            smoothed[s] = counts[s] + (PRESENT[s] ? 1 : 0);
+        }
+        codebook.BuildFromCounts(smoothed);
+    }
+
+    /**
+     * BestCodebook() Shared codebook giving a block the fewest bits
+     * @param block Block Index
+     * @param bits Number of Bits Output, UINT64_MAX when no codebook has every symbol of the block
+     * @return Integer Codebook Index, -1 when there is none
+     */
+    int BestCodebook(size_t block, uint64_t &bits) const {
+        int best = -1;
+        bits = UINT64_MAX;
+        for (size_t k = 0; k < CODEBOOKS.size(); k++) {
+            uint64_t estimate = CODEBOOKS[k].EstimateBits(BLOCK_COUNTS[block].counts);
+            if (estimate < bits) {
+                bits = estimate;
+                best = int(k);
+            }
+        }
+        return best;
+    }
+
+    /**
+     * ClusterBlocks() Seed codebooks from the block worst served so far, then alternate assigning every block to
+     * its cheapest codebook and rebuilding each codebook from the summed counts of its blocks. Only a sample of at
+     * most CLUSTER_SAMPLE_BLOCKS blocks takes part, so the cost stops growing with the input
+     */
+    void ClusterBlocks() {
+        CODEBOOKS.clear();
+        CHOICES.assign(NumBlocks(), -1);
+        vector<size_t> sample;
+        size_t step = max(size_t(1), (NumBlocks() + CLUSTER_SAMPLE_BLOCKS - 1) / CLUSTER_SAMPLE_BLOCKS);
+        for (size_t b = 0; b < NumBlocks(); b += step) {
+            sample.push_back(b);
+        }
+        // Seeding, each new codebook is built from the block paying most over its own codebook
+        vector<uint64_t> bestBits(sample.size(), UINT64_MAX);
+        size_t worst = 0;
+        while (int(CODEBOOKS.size()) < MAX_CODEBOOKS && CODEBOOKS.size() < sample.size()) {
+            HuffmanCodebook seed;
+            BuildShared(BLOCK_COUNTS[worst].counts, seed);
+            CODEBOOKS.push_back(seed);
+            uint64_t worstLoss = 0;
+            for (size_t i = 0; i < sample.size(); i++) {
+                size_t b = sample[i];
+                bestBits[i] = min(bestBits[i], seed.EstimateBits(BLOCK_COUNTS[b].counts));
+                uint64_t loss = bestBits[i] > OWN_BITS[b] ? bestBits[i] - OWN_BITS[b] : 0;
+                if (loss > worstLoss) {
+                    worstLoss = loss;
+                    worst = b;
+                }
+            }
+            if (worstLoss == 0) {
+                break;
+            }
+        }
+
+        for (int round = 0; round < CLUSTER_ROUNDS && !CODEBOOKS.empty(); round++) {
+            bool changed = false;
+            vector<BlockCounts> sums(CODEBOOKS.size(), BlockCounts());
+            vector<bool> used(CODEBOOKS.size(), false);
+            for (size_t b: sample) {
+                uint64_t bits;
+                int best = BestCodebook(b, bits);
+                changed = changed || best != CHOICES[b];
+                CHOICES[b] = best;
+                if (best < 0) {
+                    continue;
+                }
+                used[best] = true;
+                for (int s = 0; s < SYMBOL_COUNT; s++) {
+                    sums[best].counts[s] += BLOCK_COUNTS[b].counts[s];
+                }
+            }
+            if (!changed) {
+                break;
+            }
+            // A codebook no block chose keeps its lengths, it may win blocks back next round
+            for (size_t k = 0; k < CODEBOOKS.size(); k++) {
+                if (used[k]) {
+                    BuildShared(sums[k].counts, CODEBOOKS[k]);
+                }
+            }
+        }
+    }
+
+    /**
+     * ChooseCodebooks() Settle every block on its cheapest codebook, shared or its own, and drop the shared
+     * codebooks no block settled on
+     */
+    void ChooseCodebooks() {
+        vector<int> renumber(CODEBOOKS.size(), -1);
+        vector<HuffmanCodebook> kept;
+        for (size_t b = 0; b < NumBlocks(); b++) {
+            uint64_t bits;
+            int best = BestCodebook(b, bits);
+            if (best >= 0 && bits + 8 > OWN_BITS[b]) {
+                best = -1;
+            }
+            if (best >= 0 && renumber[best] < 0) {
+                renumber[best] = int(kept.size());
+                kept.push_back(CODEBOOKS[best]);
+            }
+            CHOICES[b] = best < 0 ? -1 : renumber[best];
+        }
+        CODEBOOKS.swap(kept);
+    }
+};
+
+#endif //EKHUFFMANPROJECT_SHAREDCODEBOOKENCODER_H
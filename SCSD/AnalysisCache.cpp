@@ -0,0 +1,240 @@
+/**
+ * @file AnalysisCache.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "AnalysisCache.h"
+#include "MinHashIndex.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <unistd.h>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
+
+static_assert(sizeof(CacheHeader) % alignof(uint64_t) == 0);
+
+AnalysisCache::AnalysisCache(const string &directory) : cacheDirectory(directory) {
+    error_code createError;
+    fs::create_directories(cacheDirectory, createError);
+}
+
+bool AnalysisCache::isUsable() const {
+    error_code statError;
+    return fs::is_directory(cacheDirectory, statError);
+}
+
+string AnalysisCache::getEntryPath(uint64_t contentHash) const {
+    char hashName[17];
+    snprintf(hashName, sizeof(hashName), "%016llx", static_cast<unsigned long long>(contentHash));
+    return (fs::path(cacheDirectory) / (hashName + CACHE_ENTRY_EXTENSION)).string();
+}
+
+unique_ptr<FunctionExtrapolation> AnalysisCache::loadEntry(uint64_t contentHash, size_t contentSize) {
+    MappedSource entry;
+    auto fileFunctions = make_unique<FunctionExtrapolation>();
+    if (!entry.openFile(getEntryPath(contentHash), false) ||
+        !readEntry(entry.getContents(), contentHash, contentSize, *fileFunctions)) {
+        numOfMisses += 1;
+        return nullptr;
+    }
+    // Moving The Mapping Keeps Its Address, The Functions Keep Viewing Into It
+    fileFunctions->ownedSources.push_back(std::move(entry));
+    numOfHits += 1;
+    return fileFunctions;
+}
+
+bool AnalysisCache::readEntry(string_view entry, uint64_t contentHash, size_t contentSize,
+                              FunctionExtrapolation &fileFunctions) {
+    CacheHeader header{};
+    if (entry.size() < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, entry.data(), sizeof(header));
+    if (memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || header.version != CACHE_FORMAT_VERSION ||
+        header.contentHash != contentHash || header.contentSize != contentSize ||
+        header.signatureSize != MinHashIndex().getSignatureSize()) {
+        return false;
+    }
+
+    uint64_t signatureBytes = uint64_t(header.numOfFunctions) * header.signatureSize * sizeof(uint64_t);
+    uint64_t recordBytes = uint64_t(header.numOfFunctions) * sizeof(CacheFunctionRecord);
+    uint64_t bodyBytes = uint64_t(header.numOfBodyLines) * sizeof(CacheTextRef);
+    uint64_t tokenBytes = uint64_t(header.numOfTokens) * sizeof(CacheTextRef);
+    uint64_t setBytes = uint64_t(header.numOfSetEntries) * sizeof(uint32_t);
+    if (sizeof(header) + signatureBytes + recordBytes + bodyBytes + tokenBytes + setBytes + header.numOfTextBytes !=
+        entry.size()) {
+        return false;
+    }
+
+    const char *cursor = entry.data() + sizeof(header);
+    auto signatures = reinterpret_cast<const uint64_t *>(cursor);
+    cursor += signatureBytes;
+    span<const CacheFunctionRecord> records(reinterpret_cast<const CacheFunctionRecord *>(cursor),
+                                            header.numOfFunctions);
+    cursor += recordBytes;
+    span<const CacheTextRef> bodyRefs(reinterpret_cast<const CacheTextRef *>(cursor), header.numOfBodyLines);
+    cursor += bodyBytes;
+    span<const CacheTextRef> tokenRefs(reinterpret_cast<const CacheTextRef *>(cursor), header.numOfTokens);
+    cursor += tokenBytes;
+    span<const uint32_t> setEntries(reinterpret_cast<const uint32_t *>(cursor), header.numOfSetEntries);
+    cursor += setBytes;
+    string_view text(cursor, header.numOfTextBytes);
+
+    auto toText = [&text](const CacheTextRef &textRef, string_view &viewed) {
+        if (textRef.offset > text.size() || textRef.length > text.size() - textRef.offset) {
+            return false;
+        }
+        viewed = text.substr(textRef.offset, textRef.length);
+        return true;
+    };
+
+    // Tokens Were Written In Id Order, Interning Them Into The Empty Pool Gives Back The Same Ids
+    for (uint32_t tokenId = 0; tokenId < header.numOfTokens; tokenId++) {
+        string_view token;
+        if (!toText(tokenRefs[tokenId], token) || fileFunctions.tokenPool.intern(token) != tokenId) {
+            return false;
+        }
+    }
+    for (uint32_t tokenId: setEntries) {
+        if (tokenId >= header.numOfTokens) {
+            return false;
+        }
+    }
+
+    vector<string_view> bodyLines = {};
+    fileFunctions.funcExpressions.reserve(records.size());
+    for (size_t i = 0; i < records.size(); i++) {
+        const CacheFunctionRecord &record = records[i];
+        string_view funcName, funcParams;
+        if (!toText(record.name, funcName) || !toText(record.params, funcParams) ||
+            record.bodyBegin > bodyRefs.size() || record.bodyCount > bodyRefs.size() - record.bodyBegin ||
+            record.setBegin > setEntries.size() || record.setCount > setEntries.size() - record.setBegin) {
+            return false;
+        }
+        bodyLines.resize(record.bodyCount);
+        for (uint32_t b = 0; b < record.bodyCount; b++) {
+            if (!toText(bodyRefs[record.bodyBegin + b], bodyLines[b])) {
+                return false;
+            }
+        }
+
+        FunctionExpression &funcExpr = fileFunctions.funcExpressions.emplace_back(funcName, funcParams,
+                                                                                  record.stLine);
+        funcExpr.endLine = record.endLine;
+        funcExpr.funcBody = fileFunctions.sourceArena.storeArray(span<const string_view>(bodyLines));
+        funcExpr.tokenSet = setEntries.subspan(record.setBegin, record.setCount);
+        funcExpr.signature = span<const uint64_t>(signatures + i * header.signatureSize, header.signatureSize);
+        fileFunctions.functionMetrics.appendRow(record.metrics);
+    }
+    fileFunctions.numOfFunc = int(fileFunctions.funcExpressions.size());
+    return true;
+}
+
+bool AnalysisCache::storeEntry(const FunctionExtrapolation &fileFunctions, uint64_t contentHash,
+                               size_t contentSize) {
+    uint32_t signatureSize = MinHashIndex().getSignatureSize();
+    string text = {};
+    unordered_map<string_view, CacheTextRef> textRefs = {};
+    auto addText = [&text, &textRefs](string_view piece) {
+        auto found = textRefs.find(piece);
+        if (found != textRefs.end()) {
+            return found->second;
+        }
+        CacheTextRef textRef = {uint32_t(text.size()), uint32_t(piece.size())};
+        text.append(piece);
+        textRefs.emplace(piece, textRef);
+        return textRef;
+    };
+
+    vector<uint64_t> signatures = {};
+    vector<CacheFunctionRecord> records = {};
+    vector<CacheTextRef> bodyRefs = {};
+    vector<uint32_t> setEntries = {};
+    for (size_t i = 0; i < fileFunctions.funcExpressions.size(); i++) {
+        const FunctionExpression &funcExpr = fileFunctions.funcExpressions[i];
+        if (funcExpr.signature.size() != signatureSize) {
+            return false;
+        }
+        CacheFunctionRecord record = {};
+        record.name = addText(funcExpr.funcName);
+        record.params = addText(funcExpr.funcParams);
+        record.bodyBegin = uint32_t(bodyRefs.size());
+        record.bodyCount = uint32_t(funcExpr.funcBody.size());
+        record.stLine = funcExpr.stLine;
+        record.endLine = funcExpr.endLine;
+        record.setBegin = uint32_t(setEntries.size());
+        record.setCount = uint32_t(funcExpr.tokenSet.size());
+        record.metrics = fileFunctions.functionMetrics.getRow(int(i));
+        for (string_view bodyLine: funcExpr.funcBody) {
+            bodyRefs.push_back(addText(bodyLine));
+        }
+        setEntries.insert(setEntries.end(), funcExpr.tokenSet.begin(), funcExpr.tokenSet.end());
+        signatures.insert(signatures.end(), funcExpr.signature.begin(), funcExpr.signature.end());
+        records.push_back(record);
+    }
+    vector<CacheTextRef> tokenRefs = {};
+    for (uint32_t tokenId = 0; tokenId < fileFunctions.tokenPool.getNumOfTokens(); tokenId++) {
+        tokenRefs.push_back(addText(fileFunctions.tokenPool.getToken(tokenId)));
+    }
+    // Offsets Are 32-Bit, A File Whose Text Outgrows Them Is Parsed Every Time
+    if (text.size() > numeric_limits<uint32_t>::max() || bodyRefs.size() > numeric_limits<uint32_t>::max() ||
+        setEntries.size() > numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+
+    CacheHeader header{};
+    memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = CACHE_FORMAT_VERSION;
+    header.numOfFunctions = uint32_t(records.size());
+    header.contentHash = contentHash;
+    header.contentSize = contentSize;
+    header.signatureSize = signatureSize;
+    header.numOfTokens = uint32_t(tokenRefs.size());
+    header.numOfBodyLines = uint32_t(bodyRefs.size());
+    header.numOfSetEntries = uint32_t(setEntries.size());
+    header.numOfTextBytes = uint32_t(text.size());
+
+    string entryPath = getEntryPath(contentHash);
+    string tempPath = entryPath + ".tmp" + to_string(getpid()) + "-" + to_string(numOfWrites++);
+    {
+        ofstream entryFile(tempPath, ios::binary | ios::trunc);
+        entryFile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        entryFile.write(reinterpret_cast<const char *>(signatures.data()), streamsize(signatures.size() * 8));
+        entryFile.write(reinterpret_cast<const char *>(records.data()),
+                        streamsize(records.size() * sizeof(CacheFunctionRecord)));
+        entryFile.write(reinterpret_cast<const char *>(bodyRefs.data()),
+                        streamsize(bodyRefs.size() * sizeof(CacheTextRef)));
+        entryFile.write(reinterpret_cast<const char *>(tokenRefs.data()),
+                        streamsize(tokenRefs.size() * sizeof(CacheTextRef)));
+        entryFile.write(reinterpret_cast<const char *>(setEntries.data()),
+                        streamsize(setEntries.size() * sizeof(uint32_t)));
+        entryFile.write(text.data(), streamsize(text.size()));
+        if (!entryFile.flush()) {
+            entryFile.close();
+            error_code removeError;
+            fs::remove(tempPath, removeError);
+            return false;
+        }
+    }
+    // Rename Is Atomic, Concurrent Scans Never See A Partial Entry
+    error_code renameError;
+    fs::rename(tempPath, entryPath, renameError);
+    if (renameError) {
+        fs::remove(tempPath, renameError);
+        return false;
+    }
+    return true;
+}
+
+int AnalysisCache::getNumOfHits() const {
+    return numOfHits;
+}
+
+int AnalysisCache::getNumOfMisses() const {
+    return numOfMisses;
+}
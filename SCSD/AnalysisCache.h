@@ -0,0 +1,153 @@
+/**
+ * @file AnalysisCache.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * On-Disk Cache Of Per-File Analysis, One Memory Mappable Entry Per Source Content Hash
+ */
+
+#ifndef ANALYSIS_CACHE_H
+#define ANALYSIS_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include "FunctionExtrapolation.h"
+
+using namespace std;
+
+const char CACHE_MAGIC[8] = {'S', 'C', 'S', 'D', 'I', 'D', 'X', '1'};
+const uint32_t CACHE_FORMAT_VERSION = 2;
+const string CACHE_ENTRY_EXTENSION = ".scsd";
+
+/**
+ * @struct CacheHeader
+ * @details Start Of An Entry, Followed By Signatures, Function Records, Body Line Refs, Token Refs, Token Set
+ * Entries And Text, Each Section Packed After The Previous One In Host (Little Endian) Byte Order
+ */
+struct CacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t numOfFunctions;
+    uint64_t contentHash;
+    uint64_t contentSize;
+    uint32_t signatureSize;
+    uint32_t numOfTokens;
+    uint32_t numOfBodyLines;
+    uint32_t numOfSetEntries;
+    uint32_t numOfTextBytes;
+    uint32_t reserved;
+};
+
+/**
+ * @struct CacheTextRef
+ * @details A Piece Of The Entry's Text Section, Every Distinct String Is Stored Once
+ */
+struct CacheTextRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+/**
+ * @struct CacheFunctionRecord
+ * @details One FunctionExpression, Its Body And Token Set As Ranges Of The Shared Sections, With Its Metrics
+ */
+struct CacheFunctionRecord {
+    CacheTextRef name;
+    CacheTextRef params;
+    uint32_t bodyBegin;
+    uint32_t bodyCount;
+    int32_t stLine;
+    int32_t endLine;
+    uint32_t setBegin;
+    uint32_t setCount;
+    MetricsRow metrics;
+};
+
+/**
+ * @class AnalysisCache
+ * @details Stores The Functions, Metrics, Token Sets And MinHash Signatures Of A Parsed File Under Its Content Hash, A
+ * Later Scan Maps The Entry Back In Place Of Parsing, Safe To Share Between Worker Threads
+ */
+class AnalysisCache {
+private:
+    // Directory Holding The Entries
+    string cacheDirectory;
+    // Entries Found And Not Found (Or Unusable)
+    atomic<int> numOfHits = 0;
+    atomic<int> numOfMisses = 0;
+    // Names Temporary Files Uniquely, Entries Appear Whole Or Not At All
+    atomic<unsigned int> numOfWrites = 0;
+
+    /**
+     * getEntryPath() File Path Of The Entry For A Content Hash
+     *
+     * @param contentHash uint64_t
+     * @return String
+     */
+    string getEntryPath(uint64_t contentHash) const;
+
+    /**
+     * readEntry() Validate A Mapped Entry And Rebuild Its Functions, Viewing Into The Entry
+     *
+     * @param entry string_view
+     * @param contentHash uint64_t
+     * @param contentSize size_t
+     * @param fileFunctions FunctionExtrapolation, Empty
+     * @return Boolean, False When The Entry Is Stale Or Damaged
+     */
+    static bool readEntry(string_view entry, uint64_t contentHash, size_t contentSize,
+                          FunctionExtrapolation &fileFunctions);
+
+public:
+    /**
+     * AnalysisCache() Constructor To Create Instance of AnalysisCache, Creating The Directory If Needed
+     *
+     * @param directory String
+     */
+    explicit AnalysisCache(const string &directory);
+
+    /**
+     * isUsable() Whether The Cache Directory Exists
+     *
+     * @return Boolean
+     */
+    bool isUsable() const;
+
+    /**
+     * loadEntry() Functions Of A File From Its Entry, Counted As A Hit Or A Miss
+     *
+     * @param contentHash uint64_t, hashBytes() Of The File Contents
+     * @param contentSize size_t
+     * @return unique_ptr<FunctionExtrapolation>, Null On A Miss
+     */
+    unique_ptr<FunctionExtrapolation> loadEntry(uint64_t contentHash, size_t contentSize);
+
+    /**
+     * storeEntry() Write The Entry Of A Parsed File, Its Signatures Already Computed
+     *
+     * @param fileFunctions FunctionExtrapolation, One File's Functions
+     * @param contentHash uint64_t
+     * @param contentSize size_t
+     * @return Boolean
+     */
+    bool storeEntry(const FunctionExtrapolation &fileFunctions, uint64_t contentHash, size_t contentSize);
+
+    /**
+     * getNumOfHits() Entries Loaded
+     *
+     * @return Int
+     */
+    int getNumOfHits() const;
+
+    /**
+     * getNumOfMisses() Files Parsed Because No Usable Entry Existed
+     *
+     * @return Int
+     */
+    int getNumOfMisses() const;
+};
+
+#endif //ANALYSIS_CACHE_H
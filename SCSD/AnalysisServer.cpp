@@ -0,0 +1,434 @@
+/**
+ * @file AnalysisServer.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "AnalysisServer.h"
+#include "SharedTransformation.h"
+
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <sstream>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+AnalysisServer::AnalysisServer(unsigned int threads) : scanner(threads) {
+}
+
+bool AnalysisServer::enableCache(const string &cacheDirectory) {
+    return scanner.enableCache(cacheDirectory);
+}
+
+string AnalysisServer::getCanonicalPath(const string &filePath) {
+    error_code pathError;
+    fs::path canonicalPath = fs::weakly_canonical(filePath, pathError);
+    return pathError ? filePath : canonicalPath.string();
+}
+
+int AnalysisServer::indexRepository(const string &rootPath) {
+    scanner.collectSourceFiles(rootPath);
+    vector<unique_ptr<FunctionExtrapolation>> fileResults = scanner.parseFiles();
+    int numOfIndexed = 0;
+    for (size_t i = 0; i < fileResults.size(); i++) {
+        if (fileResults[i] != nullptr) {
+            addFile(scanner.getSourcePaths()[i], std::move(fileResults[i]));
+            numOfIndexed += 1;
+        }
+    }
+    return numOfIndexed;
+}
+
+void AnalysisServer::addFile(const string &filePath, unique_ptr<FunctionExtrapolation> fileFunctions) {
+    string canonicalPath = getCanonicalPath(filePath);
+    removeFile(canonicalPath);
+    fileFunctions->internFunctionTokens();
+
+    int fileSlot = int(indexedFiles.size());
+    if (!freeFileSlots.empty()) {
+        fileSlot = freeFileSlots.back();
+        freeFileSlots.pop_back();
+    } else {
+        indexedFiles.emplace_back();
+    }
+    fileSlots[canonicalPath] = fileSlot;
+    IndexedFile &indexedFile = indexedFiles[fileSlot];
+    indexedFile.path = filePath;
+    indexedFile.fileFunctions = std::move(fileFunctions);
+
+    // File Token Ids Are Local To The File, Renamed Into The Server Wide Pool
+    const TokenPool &filePool = indexedFile.fileFunctions->getTokenPool();
+    vector<uint32_t> tokenIdMap(filePool.getNumOfTokens());
+    for (uint32_t tokenId = 0; tokenId < tokenIdMap.size(); tokenId++) {
+        tokenIdMap[tokenId] = tokenPool.intern(filePool.getToken(tokenId));
+    }
+    tokenPostings.resize(tokenPool.getNumOfTokens());
+
+    const vector<FunctionExpression> &funcExpressions = indexedFile.fileFunctions->getFunctions();
+    for (size_t funcIndex = 0; funcIndex < funcExpressions.size(); funcIndex++) {
+        const FunctionExpression &funcExpr = funcExpressions[funcIndex];
+        IndexedFunction indexedFunction;
+        indexedFunction.fileSlot = fileSlot;
+        indexedFunction.funcIndex = int(funcIndex);
+        for (uint32_t tokenId: funcExpr.tokenSet) {
+            indexedFunction.tokenSet.push_back(tokenIdMap[tokenId]);
+        }
+        toTokenSet(indexedFunction.tokenSet);
+
+        int funcSlot = int(indexedFunctions.size());
+        for (uint32_t tokenId: indexedFunction.tokenSet) {
+            tokenPostings[tokenId].push_back(funcSlot);
+        }
+        indexedFile.funcSlots.push_back(funcSlot);
+        indexedFunctions.push_back(std::move(indexedFunction));
+    }
+}
+
+bool AnalysisServer::removeFile(const string &canonicalPath) {
+    auto found = fileSlots.find(canonicalPath);
+    if (found == fileSlots.end()) {
+        return false;
+    }
+    IndexedFile &indexedFile = indexedFiles[found->second];
+    for (int funcSlot: indexedFile.funcSlots) {
+        indexedFunctions[funcSlot].isLive = false;
+        indexedFunctions[funcSlot].tokenSet = {};
+        numOfDeadFunctions += 1;
+    }
+    indexedFile = IndexedFile();
+    freeFileSlots.push_back(found->second);
+    fileSlots.erase(found);
+    return true;
+}
+
+void AnalysisServer::compactIndex() {
+    vector<int> renumbered(indexedFunctions.size(), -1);
+    vector<IndexedFunction> liveFunctions = {};
+    liveFunctions.reserve(indexedFunctions.size() - numOfDeadFunctions);
+    for (size_t funcSlot = 0; funcSlot < indexedFunctions.size(); funcSlot++) {
+        if (indexedFunctions[funcSlot].isLive) {
+            renumbered[funcSlot] = int(liveFunctions.size());
+            liveFunctions.push_back(std::move(indexedFunctions[funcSlot]));
+        }
+    }
+    for (IndexedFile &indexedFile: indexedFiles) {
+        for (int &funcSlot: indexedFile.funcSlots) {
+            funcSlot = renumbered[funcSlot];
+        }
+    }
+    // Renumbering Keeps Slot Order, Postings Stay Sorted
+    for (vector<int> &posting: tokenPostings) {
+        size_t numOfKept = 0;
+        for (int funcSlot: posting) {
+            if (renumbered[funcSlot] >= 0) {
+                posting[numOfKept++] = renumbered[funcSlot];
+            }
+        }
+        posting.resize(numOfKept);
+    }
+    indexedFunctions = std::move(liveFunctions);
+    numOfDeadFunctions = 0;
+}
+
+const FunctionExpression &AnalysisServer::getExpression(int funcSlot) const {
+    const IndexedFunction &indexedFunction = indexedFunctions[funcSlot];
+    return indexedFiles[indexedFunction.fileSlot].fileFunctions->getFunctions()[indexedFunction.funcIndex];
+}
+
+MetricsRow AnalysisServer::getMetrics(int funcSlot) const {
+    const IndexedFunction &indexedFunction = indexedFunctions[funcSlot];
+    return indexedFiles[indexedFunction.fileSlot].fileFunctions->getMetrics().getRow(indexedFunction.funcIndex);
+}
+
+string AnalysisServer::describeFunction(int funcSlot) const {
+    const FunctionExpression &funcExpr = getExpression(funcSlot);
+    return string(funcExpr.funcName) + " (" + indexedFiles[indexedFunctions[funcSlot].fileSlot].path + ":" +
+           to_string(funcExpr.stLine) + ")";
+}
+
+vector<int> AnalysisServer::findFunctions(const string &query) const {
+    vector<int> foundSlots = {};
+    for (const pair<const string, int> &fileSlot: fileSlots) {
+        const IndexedFile &indexedFile = indexedFiles[fileSlot.second];
+        for (int funcSlot: indexedFile.funcSlots) {
+            const FunctionExpression &funcExpr = getExpression(funcSlot);
+            // "int area" Is Also Found As "area"
+            string_view bareName = funcExpr.funcName.substr(funcExpr.funcName.find_last_of(" *&") + 1);
+            if (funcExpr.funcName == query || bareName == query ||
+                indexedFile.path + ":" + to_string(funcExpr.stLine) == query) {
+                foundSlots.push_back(funcSlot);
+            }
+        }
+    }
+    return foundSlots;
+}
+
+vector<pair<int, double>> AnalysisServer::rankSimilarFunctions(int funcSlot, double threshold, size_t limit) const {
+    const vector<uint32_t> &probeSet = indexedFunctions[funcSlot].tokenSet;
+    vector<uint32_t> probeTokens = probeSet;
+    sort(probeTokens.begin(), probeTokens.end(), [this](uint32_t a, uint32_t b) {
+        return tokenPostings[a].size() < tokenPostings[b].size();
+    });
+
+    // A Match Shares At Least ceil(threshold * |probe|) Tokens, So It Holds One Of The Rest Plus One Rarest
+    size_t numOfProbed = probeTokens.size();
+    if (threshold > 0.0) {
+        size_t numOfShared = size_t(ceil(max(0.0, threshold - FILTER_SLACK) * double(probeTokens.size())));
+        numOfProbed = min(probeTokens.size(), probeTokens.size() - min(numOfShared, probeTokens.size()) + 1);
+    }
+
+    vector<bool> isSeen(indexedFunctions.size(), false);
+    vector<pair<int, double>> similarFunctions = {};
+    for (size_t i = 0; i < numOfProbed; i++) {
+        for (int candidate: tokenPostings[probeTokens[i]]) {
+            if (candidate == funcSlot || isSeen[candidate] || !indexedFunctions[candidate].isLive) {
+                continue;
+            }
+            isSeen[candidate] = true;
+            double similarIndex = getJaccardSimilarIndex(span<const uint32_t>(probeSet),
+                                                         span<const uint32_t>(indexedFunctions[candidate].tokenSet));
+            if (similarIndex >= threshold) {
+                similarFunctions.emplace_back(candidate, similarIndex);
+            }
+        }
+    }
+
+    auto isRankedBefore = [this](const pair<int, double> &a, const pair<int, double> &b) {
+        if (a.second != b.second) {
+            return a.second > b.second;
+        }
+        const IndexedFunction &first = indexedFunctions[a.first], &second = indexedFunctions[b.first];
+        const string &firstPath = indexedFiles[first.fileSlot].path, &secondPath = indexedFiles[second.fileSlot].path;
+        return firstPath != secondPath ? firstPath < secondPath : first.funcIndex < second.funcIndex;
+    };
+    size_t numOfKept = min(limit, similarFunctions.size());
+    partial_sort(similarFunctions.begin(), similarFunctions.begin() + numOfKept, similarFunctions.end(),
+                 isRankedBefore);
+    similarFunctions.resize(numOfKept);
+    return similarFunctions;
+}
+
+string AnalysisServer::handleCommand(const string &commandLine) {
+    istringstream commandStream(commandLine);
+    string command, argument;
+    commandStream >> command;
+    getline(commandStream >> ws, argument);
+    argument = string(spaceStripView(argument));
+    ostringstream response;
+
+    if (command == "list") {
+        for (const pair<const string, int> &fileSlot: fileSlots) {
+            for (int funcSlot: indexedFiles[fileSlot.second].funcSlots) {
+                const FunctionExpression &funcExpr = getExpression(funcSlot);
+                response << "\t" << funcExpr.funcName << funcExpr.funcParams << " ("
+                         << indexedFiles[fileSlot.second].path << ":" << funcExpr.stLine << ")\n";
+            }
+        }
+    } else if (command == "long" || command == "params" || command == "complex") {
+        bool flaggedExists = false;
+        for (const pair<const string, int> &fileSlot: fileSlots) {
+            for (int funcSlot: indexedFiles[fileSlot.second].funcSlots) {
+                MetricsRow metrics = getMetrics(funcSlot);
+                if (command == "long" && metrics[METRIC_LENGTH] > FUN_SIZE_MAX) {
+                    response << "\t" << describeFunction(funcSlot) << "\t---> Func Length Size: "
+                             << metrics[METRIC_LENGTH] << "\n";
+                } else if (command == "params" && metrics[METRIC_PARAMS] > FUN_PARAM_THRESHOLD) {
+                    response << "\t" << describeFunction(funcSlot) << "\t---> Num Of Parameters: "
+                             << metrics[METRIC_PARAMS] << "\n";
+                } else if (command == "complex" && (metrics[METRIC_CYCLOMATIC] > FUN_COMPLEXITY_MAX ||
+                                                    metrics[METRIC_NESTING] > FUN_NESTING_MAX)) {
+                    response << "\t" << describeFunction(funcSlot) << "\t---> Cyclomatic Complexity: "
+                             << metrics[METRIC_CYCLOMATIC] << ", Nesting Depth: " << metrics[METRIC_NESTING] << "\n";
+                } else {
+                    continue;
+                }
+                flaggedExists = true;
+            }
+        }
+        if (!flaggedExists) {
+            response << "\tNo Matching Functions\n";
+        }
+    } else if (command == "duplicates" || command == "similar") {
+        bool isTopK = command == "similar";
+        size_t topK = SERVER_DEFAULT_TOP_K;
+        size_t lastSpace = argument.find_last_of(' ');
+        if (isTopK && lastSpace != string::npos &&
+            argument.find_first_not_of("0123456789", lastSpace + 1) == string::npos) {
+            // A Client's Count Must Not Throw, A Count Past The Functions Indexed Asks For All Of Them
+            const char *countEnd = argument.data() + argument.size();
+            auto [parsedEnd, parseError] = from_chars(argument.data() + lastSpace + 1, countEnd, topK);
+            if (parseError != errc() || parsedEnd != countEnd) {
+                response << "Invalid Count: " << argument.substr(lastSpace + 1) << "\n";
+                return response.str();
+            }
+            topK = min(topK, size_t(getNumOfFunctions()));
+            argument = string(spaceStripView(string_view(argument).substr(0, lastSpace)));
+        }
+        vector<int> foundSlots = findFunctions(argument);
+        if (foundSlots.empty()) {
+            response << "Unknown Function: " << argument << "\n";
+        }
+        bool duplicateExists = false;
+        for (int funcSlot: foundSlots) {
+            vector<pair<int, double>> similarFunctions = isTopK ? rankSimilarFunctions(funcSlot, 0.0, topK)
+                                                                : rankSimilarFunctions(funcSlot,
+                                                                                       JACCARD_INDEX_THRESHOLD,
+                                                                                       indexedFunctions.size());
+            for (const pair<int, double> &similar: similarFunctions) {
+                if (isTopK) {
+                    response << "\t" << describeFunction(funcSlot) << " ~ " << describeFunction(similar.first)
+                             << "\t---> Similarity: " << similar.second << "\n";
+                } else {
+                    response << "\t" << describeFunction(funcSlot) << " & " << describeFunction(similar.first)
+                             << " are duplicate\n";
+                }
+                duplicateExists = true;
+            }
+        }
+        if (!foundSlots.empty() && !duplicateExists) {
+            response << (isTopK ? "\tNo Similar Functions\n" : "\tNo Functions are Duplicate\n");
+        }
+    } else if (command == "changed") {
+        auto startTime = chrono::steady_clock::now();
+        string canonicalPath = getCanonicalPath(argument);
+        error_code statError;
+        if (!fs::is_regular_file(argument, statError)) {
+            response << (removeFile(canonicalPath) ? "Removed " : "Not Indexed ") << argument << "\n";
+        } else if (!RepositoryScanner::isSourceFile(argument)) {
+            response << "Not A Source File: " << argument << "\n";
+        } else {
+            unique_ptr<FunctionExtrapolation> fileFunctions = scanner.parseFile(argument);
+            if (fileFunctions == nullptr) {
+                response << "Unreadable: " << argument << "\n";
+            } else {
+                int numOfFileFunctions = int(fileFunctions->getFunctions().size());
+                addFile(argument, std::move(fileFunctions));
+                double elapsedMs = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+                response << "Indexed " << argument << ": " << numOfFileFunctions << " Functions In " << elapsedMs
+                         << " ms\n";
+            }
+        }
+        if (numOfDeadFunctions > getNumOfFunctions()) {
+            compactIndex();
+        }
+    } else if (command == "stats") {
+        response << "Files: " << fileSlots.size() << ", Functions: " << getNumOfFunctions()
+                 << ", Tokens: " << tokenPool.getNumOfTokens() << "\n";
+    } else if (command == "shutdown") {
+        isRunning = false;
+        response << "Shutting Down\n";
+    } else if (!command.empty()) {
+        response << "Unknown Command: " << command << "\n";
+    }
+    return response.str();
+}
+
+bool AnalysisServer::serveClient(int clientSocket, string &pending) {
+    char readBuffer[4096];
+    ssize_t numOfRead = read(clientSocket, readBuffer, sizeof(readBuffer));
+    if (numOfRead < 0 && (errno == EINTR || errno == EAGAIN)) {
+        return true;
+    }
+    if (numOfRead <= 0) {
+        return false;
+    }
+    pending.append(readBuffer, size_t(numOfRead));
+
+    size_t lineEnd;
+    while (isRunning && (lineEnd = pending.find('\n')) != string::npos) {
+        string commandLine = pending.substr(0, lineEnd);
+        pending.erase(0, lineEnd + 1);
+        string response = handleCommand(commandLine) + ".\n";
+        size_t numOfSent = 0;
+        while (numOfSent < response.size()) {
+            ssize_t sendResult = send(clientSocket, response.data() + numOfSent, response.size() - numOfSent,
+                                      MSG_NOSIGNAL);
+            if (sendResult < 0 && errno == EINTR) {
+                continue;
+            }
+            if (sendResult <= 0) {
+                return false;
+            }
+            numOfSent += size_t(sendResult);
+        }
+    }
+    return true;
+}
+
+bool AnalysisServer::serve(const string &socketPath) {
+    sockaddr_un address{};
+    if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path)) {
+        return false;
+    }
+    address.sun_family = AF_UNIX;
+    socketPath.copy(address.sun_path, socketPath.size());
+
+    // A Socket Left By An Earlier Server Is Replaced, Any Other File Is Not
+    struct stat socketInfo{};
+    if (lstat(socketPath.c_str(), &socketInfo) == 0 && S_ISSOCK(socketInfo.st_mode)) {
+        unlink(socketPath.c_str());
+    }
+
+    int listenSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listenSocket < 0) {
+        return false;
+    }
+    if (bind(listenSocket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+        listen(listenSocket, SERVER_LISTEN_BACKLOG) != 0) {
+        close(listenSocket);
+        return false;
+    }
+
+    // Commands Run On This Thread One At A Time, So The Index Needs No Locking
+    map<int, string> clientInputs;
+    vector<pollfd> watched;
+    isRunning = true;
+    while (isRunning) {
+        watched.clear();
+        watched.push_back({listenSocket, POLLIN, 0});
+        for (const auto &[clientSocket, pending]: clientInputs) {
+            watched.push_back({clientSocket, POLLIN, 0});
+        }
+        if (poll(watched.data(), watched.size(), -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        for (size_t i = 1; i < watched.size() && isRunning; i++) {
+            if (watched[i].revents != 0 && !serveClient(watched[i].fd, clientInputs[watched[i].fd])) {
+                close(watched[i].fd);
+                clientInputs.erase(watched[i].fd);
+            }
+        }
+        if (isRunning && watched[0].revents != 0) {
+            int clientSocket = accept4(listenSocket, nullptr, nullptr, SOCK_CLOEXEC);
+            if (clientSocket >= 0) {
+                timeval sendTimeout{SERVER_SEND_TIMEOUT_SECONDS, 0};
+                setsockopt(clientSocket, SOL_SOCKET, SO_SNDTIMEO, &sendTimeout, sizeof(sendTimeout));
+                clientInputs[clientSocket] = "";
+            } else if (errno != EINTR && errno != ECONNABORTED && errno != EAGAIN) {
+                break;
+            }
+        }
+    }
+    for (const auto &[clientSocket, pending]: clientInputs) {
+        close(clientSocket);
+    }
+    close(listenSocket);
+    unlink(socketPath.c_str());
+    return true;
+}
+
+int AnalysisServer::getNumOfFunctions() const {
+    return int(indexedFunctions.size()) - numOfDeadFunctions;
+}
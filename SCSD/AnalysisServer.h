@@ -0,0 +1,207 @@
+/**
+ * @file AnalysisServer.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Long-Running Analysis Of A Repository, Queried Over A Unix Socket And Updated One File At A Time
+ */
+
+#ifndef ANALYSIS_SERVER_H
+#define ANALYSIS_SERVER_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "FunctionExtrapolation.h"
+#include "RepositoryScanner.h"
+#include "TokenPool.h"
+
+using namespace std;
+
+const size_t SERVER_DEFAULT_TOP_K = 10;
+const int SERVER_LISTEN_BACKLOG = 16;
+// A Client That Stops Reading Its Responses Is Dropped After This Long, So It Cannot Stall The Others
+const int SERVER_SEND_TIMEOUT_SECONDS = 5;
+
+/**
+ * @struct IndexedFunction
+ * @details A Function Of An Indexed File, With What Queries Need Computed Once When The File Is Indexed
+ */
+struct IndexedFunction {
+    // Slot Of The Owning File
+    int fileSlot = -1;
+    // Position Among The File's Functions
+    int funcIndex = 0;
+    // Token Set In Server Wide Ids, Sorted Without Repeats
+    vector<uint32_t> tokenSet = {};
+    // False Once Its File Changed, Until The Index Is Compacted
+    bool isLive = true;
+};
+
+/**
+ * @struct IndexedFile
+ * @details One Source File, Its Functions Owned By Its Own FunctionExtrapolation
+ */
+struct IndexedFile {
+    string path;
+    unique_ptr<FunctionExtrapolation> fileFunctions = nullptr;
+    // Slots Of Its Functions, In Source Order
+    vector<int> funcSlots = {};
+};
+
+/**
+ * @class AnalysisServer
+ * @details Keeps Every File's Functions And An Inverted Token Index In Memory, Answers One Command Per Line:
+ * list, long, params, complex, duplicates <function>, similar <function> [k], changed <path>, stats, shutdown
+ */
+class AnalysisServer {
+private:
+    // Collects And Parses Files, Through The Cache When Enabled
+    RepositoryScanner scanner;
+    // Indexed Files, Freed Slots Are Reused
+    vector<IndexedFile> indexedFiles = {};
+    vector<int> freeFileSlots = {};
+    // Canonical Path -> File Slot
+    map<string, int> fileSlots = {};
+    // Every Function Ever Indexed, Dead Ones Included Until Compaction
+    vector<IndexedFunction> indexedFunctions = {};
+    int numOfDeadFunctions = 0;
+    // Server Wide Token Ids
+    TokenPool tokenPool;
+    // Token Id -> Function Slots Containing It
+    vector<vector<int>> tokenPostings = {};
+    // Cleared By The shutdown Command
+    bool isRunning = false;
+
+    /**
+     * getCanonicalPath() Path Used To Recognise A File However A Client Spells It
+     *
+     * @param filePath String
+     * @return String
+     */
+    static string getCanonicalPath(const string &filePath);
+
+    /**
+     * addFile() Index A Parsed File, Replacing Any Earlier Version Of It
+     *
+     * @param filePath String
+     * @param fileFunctions unique_ptr<FunctionExtrapolation>
+     */
+    void addFile(const string &filePath, unique_ptr<FunctionExtrapolation> fileFunctions);
+
+    /**
+     * removeFile() Drop A File And Mark Its Functions Dead
+     *
+     * @param canonicalPath String
+     * @return Boolean, False When The File Was Not Indexed
+     */
+    bool removeFile(const string &canonicalPath);
+
+    /**
+     * compactIndex() Renumber Live Functions And Rebuild The Postings Without Dead Ones
+     */
+    void compactIndex();
+
+    /**
+     * getExpression() FunctionExpression Behind An Indexed Function
+     *
+     * @param funcSlot Int
+     * @return FunctionExpression
+     */
+    const FunctionExpression &getExpression(int funcSlot) const;
+
+    /**
+     * getMetrics() Metrics Of The File Owning An Indexed Function
+     *
+     * @param funcSlot Int
+     * @return MetricsRow
+     */
+    MetricsRow getMetrics(int funcSlot) const;
+
+    /**
+     * describeFunction() Function Name With Its File Location
+     *
+     * @param funcSlot Int
+     * @return String
+     */
+    string describeFunction(int funcSlot) const;
+
+    /**
+     * findFunctions() Live Functions Named By A Query, Either A Function Name Or path:line
+     *
+     * @param query String
+     * @return vector<int> Function Slots, In Path Order
+     */
+    vector<int> findFunctions(const string &query) const;
+
+    /**
+     * rankSimilarFunctions() Functions At Least threshold Similar To One Function, Most Similar First
+     *
+     * @param funcSlot Int
+     * @param threshold Double, Above Zero Only The Rarest Tokens That Any Such Match Must Share Are Probed
+     * @param limit size_t, Most Results Kept
+     * @return vector<pair<int, double>> Function Slot And Jaccard Index
+     */
+    vector<pair<int, double>> rankSimilarFunctions(int funcSlot, double threshold, size_t limit) const;
+
+    /**
+     * serveClient() Read What A Readable Client Sent And Answer Each Whole Command Line In It
+     *
+     * @param clientSocket Int File Descriptor
+     * @param pending String, The Client's Unfinished Command Line, Kept Between Calls
+     * @return Boolean, False Once The Client Disconnected Or Cannot Be Answered
+     */
+    bool serveClient(int clientSocket, string &pending);
+
+public:
+    /**
+     * AnalysisServer() Constructor To Create Instance of AnalysisServer
+     *
+     * @param threads Unsigned Int, Parser Threads For The Initial Scan, Zero Uses One Per Hardware Thread
+     */
+    explicit AnalysisServer(unsigned int threads = 0);
+
+    /**
+     * enableCache() Parse Through An AnalysisCache Directory
+     *
+     * @param cacheDirectory String
+     * @return Boolean
+     */
+    bool enableCache(const string &cacheDirectory);
+
+    /**
+     * indexRepository() Scan A Directory Tree Or File In Parallel And Index Every File
+     *
+     * @param rootPath String
+     * @return Int Number of Files Indexed
+     */
+    int indexRepository(const string &rootPath);
+
+    /**
+     * handleCommand() Run One Command
+     *
+     * @param commandLine String
+     * @return String Response Text
+     */
+    string handleCommand(const string &commandLine);
+
+    /**
+     * serve() Listen On A Unix Socket Until A Client Sends shutdown, Each Response Ends With A "." Line. Every
+     * Connected Client Is Polled, An Idle One Holds Up No Other, And Commands Still Run One At A Time
+     *
+     * @param socketPath String
+     * @return Boolean, False When The Socket Cannot Be Opened
+     */
+    bool serve(const string &socketPath);
+
+    /**
+     * getNumOfFunctions() Live Indexed Functions
+     *
+     * @return Int
+     */
+    int getNumOfFunctions() const;
+};
+
+#endif //ANALYSIS_SERVER_H
@@ -0,0 +1,86 @@
+/**
+ * @file AnalysisStatistics.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "AnalysisStatistics.h"
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+void AnalysisStatistics::addPhaseTime(AnalysisPhase phase, chrono::steady_clock::duration elapsed) {
+    phaseNanoseconds[phase].fetch_add(chrono::duration_cast<chrono::nanoseconds>(elapsed).count(),
+                                      memory_order_relaxed);
+}
+
+void AnalysisStatistics::addParsed(int64_t lines, int64_t functions) {
+    numOfLines.fetch_add(lines, memory_order_relaxed);
+    numOfFunctions.fetch_add(functions, memory_order_relaxed);
+}
+
+void AnalysisStatistics::addCandidates(int64_t considered, int64_t pruned, int64_t compared) {
+    numOfConsidered.fetch_add(considered, memory_order_relaxed);
+    numOfPruned.fetch_add(pruned, memory_order_relaxed);
+    numOfCompared.fetch_add(compared, memory_order_relaxed);
+}
+
+void AnalysisStatistics::addExactDuplicates(int64_t grouped) {
+    numOfExactDuplicates.fetch_add(grouped, memory_order_relaxed);
+}
+
+void AnalysisStatistics::recordTokenSetSize(int64_t tokenSetSize) {
+    int64_t peakSize = peakTokenSetSize.load(memory_order_relaxed);
+    while (tokenSetSize > peakSize &&
+           !peakTokenSetSize.compare_exchange_weak(peakSize, tokenSetSize, memory_order_relaxed)) {
+    }
+}
+
+double AnalysisStatistics::getPhaseSeconds(AnalysisPhase phase) const {
+    return double(phaseNanoseconds[phase].load(memory_order_relaxed)) / 1e9;
+}
+
+double AnalysisStatistics::getLinesPerSecond() const {
+    double seconds = getPhaseSeconds(PHASE_READ) + getPhaseSeconds(PHASE_PARSE);
+    return seconds > 0.0 ? double(numOfLines.load()) / seconds : 0.0;
+}
+
+void AnalysisStatistics::printSummary() const {
+    ostringstream summary;
+    summary << "\n--Analysis Statistics--\n" << fixed << setprecision(3);
+    for (int phase = 0; phase < NUM_OF_PHASES; phase++) {
+        summary << "\t" << left << setw(24) << ("Phase " + analysisPhaseNames[phase] + " (s)") << right
+                << setw(16) << getPhaseSeconds(AnalysisPhase(phase)) << "\n";
+    }
+    double totalSeconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+    summary << "\t" << left << setw(24) << "Wall Time (s)" << right << setw(16) << totalSeconds << "\n"
+            << setprecision(0)
+            << "\t" << left << setw(24) << "Lines Per Second" << right << setw(16) << getLinesPerSecond() << "\n"
+            << "\t" << left << setw(24) << "Lines" << right << setw(16) << numOfLines.load() << "\n"
+            << "\t" << left << setw(24) << "Functions" << right << setw(16) << numOfFunctions.load() << "\n"
+            << "\t" << left << setw(24) << "Pairs Considered" << right << setw(16) << numOfConsidered.load() << "\n"
+            << "\t" << left << setw(24) << "Pairs Pruned" << right << setw(16) << numOfPruned.load() << "\n"
+            << "\t" << left << setw(24) << "Pairs Compared" << right << setw(16) << numOfCompared.load() << "\n"
+            << "\t" << left << setw(24) << "Exact Duplicates" << right << setw(16) << numOfExactDuplicates.load()
+            << "\n"
+            << "\t" << left << setw(24) << "Peak Token Set Size" << right << setw(16) << peakTokenSetSize.load()
+            << "\n";
+    cout << summary.str();
+}
+
+string AnalysisStatistics::toJson() const {
+    ostringstream json;
+    json << fixed << setprecision(6) << "{\"phases\":{";
+    for (int phase = 0; phase < NUM_OF_PHASES; phase++) {
+        json << (phase > 0 ? "," : "") << "\"" << analysisPhaseNames[phase] << "\":"
+             << getPhaseSeconds(AnalysisPhase(phase));
+    }
+    json << "},\"wallSeconds\":" << chrono::duration<double>(chrono::steady_clock::now() - startTime).count()
+         << ",\"linesPerSecond\":" << setprecision(1) << getLinesPerSecond()
+         << ",\"lines\":" << numOfLines.load() << ",\"functions\":" << numOfFunctions.load()
+         << ",\"pairs\":{\"considered\":" << numOfConsidered.load() << ",\"pruned\":" << numOfPruned.load()
+         << ",\"compared\":" << numOfCompared.load() << "},\"exactDuplicates\":" << numOfExactDuplicates.load()
+         << ",\"peakTokenSetSize\":" << peakTokenSetSize.load() << "}";
+    return json.str();
+}
@@ -0,0 +1,152 @@
+/**
+ * @file AnalysisStatistics.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Phase Timers And Pruning Counters Of An Analysis, Shared By Every Worker Of A Scan
+ */
+
+#ifndef ANALYSIS_STATISTICS_H
+#define ANALYSIS_STATISTICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+/**
+ * @enum AnalysisPhase
+ * @details A Timed Part Of An Analysis
+ */
+enum AnalysisPhase {
+    PHASE_READ, PHASE_PARSE, PHASE_METRIC, PHASE_DUPLICATE, NUM_OF_PHASES
+};
+
+const array<string, NUM_OF_PHASES> analysisPhaseNames = {"read", "parse", "metric", "duplicate"};
+
+/**
+ * @class AnalysisStatistics
+ * @details Counters Are Atomic So Parallel Workers Record Into One Instance, Phase Times Are Summed Over Threads
+ */
+class AnalysisStatistics {
+private:
+    // Nanoseconds Spent In Each Phase
+    array<atomic<int64_t>, NUM_OF_PHASES> phaseNanoseconds = {};
+    atomic<int64_t> numOfLines = 0;
+    atomic<int64_t> numOfFunctions = 0;
+    // Duplicate Candidate Pairs Considered, Rejected By A Filter, And Given A Full Jaccard Comparison
+    atomic<int64_t> numOfConsidered = 0;
+    atomic<int64_t> numOfPruned = 0;
+    atomic<int64_t> numOfCompared = 0;
+    atomic<int64_t> numOfExactDuplicates = 0;
+    atomic<int64_t> peakTokenSetSize = 0;
+    // Wall Clock Start, Reported As The Total
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+    /**
+     * getPhaseSeconds() Seconds Recorded For A Phase
+     *
+     * @param phase AnalysisPhase
+     * @return Double
+     */
+    double getPhaseSeconds(AnalysisPhase phase) const;
+
+    /**
+     * getLinesPerSecond() Lines Read And Parsed Per Second Of Read And Parse Time
+     *
+     * @return Double
+     */
+    double getLinesPerSecond() const;
+
+public:
+    /**
+     * addPhaseTime() Add Time Spent In A Phase
+     *
+     * @param phase AnalysisPhase
+     * @param elapsed chrono::steady_clock::duration
+     */
+    void addPhaseTime(AnalysisPhase phase, chrono::steady_clock::duration elapsed);
+
+    /**
+     * addParsed() Count Lines Parsed And Functions Found
+     *
+     * @param lines Int64
+     * @param functions Int64
+     */
+    void addParsed(int64_t lines, int64_t functions);
+
+    /**
+     * addCandidates() Count Duplicate Candidate Pairs
+     *
+     * @param considered Int64
+     * @param pruned Int64
+     * @param compared Int64
+     */
+    void addCandidates(int64_t considered, int64_t pruned, int64_t compared);
+
+    /**
+     * addExactDuplicates() Count Functions Grouped By Body Hash, Kept Out Of The Duplicate Engine
+     *
+     * @param grouped Int64
+     */
+    void addExactDuplicates(int64_t grouped);
+
+    /**
+     * recordTokenSetSize() Keep The Largest Token Set Seen
+     *
+     * @param tokenSetSize Int64
+     */
+    void recordTokenSetSize(int64_t tokenSetSize);
+
+    /**
+     * printSummary() Print Every Counter As A Table
+     */
+    void printSummary() const;
+
+    /**
+     * toJson() Every Counter As One Line Of JSON
+     *
+     * @return String
+     */
+    string toJson() const;
+};
+
+/**
+ * @class PhaseTimer
+ * @details Adds The Time Between Its Construction And Destruction To A Phase, Does Nothing Without Statistics
+ */
+class PhaseTimer {
+private:
+    AnalysisStatistics *analysisStatistics;
+    AnalysisPhase timedPhase;
+    chrono::steady_clock::time_point startTime = {};
+
+public:
+    /**
+     * PhaseTimer() Constructor To Start Timing, The Clock Is Only Read When Statistics Are Enabled
+     *
+     * @param statistics AnalysisStatistics, Null When Disabled
+     * @param phase AnalysisPhase
+     */
+    PhaseTimer(AnalysisStatistics *statistics, AnalysisPhase phase) : analysisStatistics(statistics),
+                                                                       timedPhase(phase) {
+        if (analysisStatistics != nullptr) {
+            startTime = chrono::steady_clock::now();
+        }
+    }
+
+    PhaseTimer(const PhaseTimer &) = delete;
+
+    PhaseTimer &operator=(const PhaseTimer &) = delete;
+
+    ~PhaseTimer() {
+        if (analysisStatistics != nullptr) {
+            analysisStatistics->addPhaseTime(timedPhase, chrono::steady_clock::now() - startTime);
+        }
+    }
+};
+
+#endif //ANALYSIS_STATISTICS_H
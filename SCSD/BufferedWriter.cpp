@@ -0,0 +1,62 @@
+/**
+ * @file BufferedWriter.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "BufferedWriter.h"
+
+#include <algorithm>
+#include <cstring>
+
+BufferedWriter::BufferedWriter(FILE *output, size_t capacity) : outputFile(output),
+                                                               outputBuffer(max<size_t>(1, capacity)) {
+}
+
+BufferedWriter::BufferedWriter(const string &filePath, size_t capacity) : outputBuffer(max<size_t>(1, capacity)) {
+    outputFile = fopen(filePath.c_str(), "wb");
+    ownsFile = outputFile != nullptr;
+}
+
+BufferedWriter::~BufferedWriter() {
+    flush();
+    if (ownsFile) {
+        fclose(outputFile);
+    }
+}
+
+bool BufferedWriter::isOpen() const {
+    return outputFile != nullptr;
+}
+
+void BufferedWriter::write(string_view text) {
+    if (text.size() > outputBuffer.size() - numOfBuffered) {
+        flush();
+        if (text.size() >= outputBuffer.size()) {
+            hasFailed = hasFailed || outputFile == nullptr ||
+                        fwrite(text.data(), 1, text.size(), outputFile) != text.size();
+            return;
+        }
+    }
+    memcpy(outputBuffer.data() + numOfBuffered, text.data(), text.size());
+    numOfBuffered += text.size();
+}
+
+bool BufferedWriter::flush() {
+    if (numOfBuffered > 0) {
+        hasFailed = hasFailed || outputFile == nullptr ||
+                    fwrite(outputBuffer.data(), 1, numOfBuffered, outputFile) != numOfBuffered;
+        numOfBuffered = 0;
+    }
+    if (outputFile != nullptr) {
+        hasFailed = fflush(outputFile) != 0 || hasFailed;
+    }
+    return !hasFailed;
+}
+
+BufferedWriter &BufferedWriter::operator<<(double value) {
+    char digits[32];
+    int numOfDigits = snprintf(digits, sizeof(digits), "%g", value);
+    write(string_view(digits, size_t(max(0, numOfDigits))));
+    return *this;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file BufferedWriter.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Large Output Buffer Written To A File Or Standard Output In Few, Big Writes
+ */
+
+#ifndef BUFFERED_WRITER_H
+#define BUFFERED_WRITER_H
+
+#include <charconv>
+#include <concepts>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+const size_t WRITER_BUFFER_SIZE = size_t(1) << 20;
+
+/**
+ * @class BufferedWriter
+ * @details Formats Into Its Own Buffer And Only Writes When It Fills, Standard Output Is Written Through stdio, So
+ * Text Already Sent To cout Stays In Order
+ */
+class BufferedWriter {
+private:
+    // Destination, Closed Here Only When Opened Here
+    FILE *outputFile = nullptr;
+    bool ownsFile = false;
+    // Pending Bytes, [0, numOfBuffered)
+    vector<char> outputBuffer;
+    size_t numOfBuffered = 0;
+    // Set Once A Write Fails
+    bool hasFailed = false;
+
+public:
+    /**
+     * BufferedWriter() Constructor To Create Instance of BufferedWriter Over An Open Stream
+     *
+     * @param output FILE, Not Closed By The Writer
+     * @param capacity size_t, Buffer Bytes
+     */
+    explicit BufferedWriter(FILE *output, size_t capacity = WRITER_BUFFER_SIZE);
+
+    /**
+     * BufferedWriter() Constructor To Create Instance of BufferedWriter, Creating Or Truncating A File
+     *
+     * @param filePath String
+     * @param capacity size_t, Buffer Bytes
+     */
+    explicit BufferedWriter(const string &filePath, size_t capacity = WRITER_BUFFER_SIZE);
+
+    BufferedWriter(const BufferedWriter &) = delete;
+
+    BufferedWriter &operator=(const BufferedWriter &) = delete;
+
+    /**
+     * ~BufferedWriter() Flush, Then Close A File The Writer Opened
+     */
+    ~BufferedWriter();
+
+    /**
+     * isOpen() Whether The Destination Could Be Opened
+     *
+     * @return Boolean
+     */
+    bool isOpen() const;
+
+    /**
+     * write() Append Text, Text Larger Than The Buffer Is Written Straight Through
+     *
+     * @param text string_view
+     */
+    void write(string_view text);
+
+    /**
+     * flush() Write Every Pending Byte
+     *
+     * @return Boolean, False When Any Write Failed
+     */
+    bool flush();
+
+    BufferedWriter &operator<<(string_view text) {
+        write(text);
+        return *this;
+    }
+
+    BufferedWriter &operator<<(char letter) {
+        if (numOfBuffered == outputBuffer.size()) {
+            flush();
+        }
+        outputBuffer[numOfBuffered++] = letter;
+        return *this;
+    }
+
+    template<integral Integer>
+    BufferedWriter &operator<<(Integer value) {
+        char digits[24];
+        to_chars_result converted = to_chars(begin(digits), end(digits), value);
+        write(string_view(digits, size_t(converted.ptr - digits)));
+        return *this;
+    }
+
+    /**
+     * operator<<() Append A Double As An ostream Would By Default, Six Significant Digits
+     */
+    BufferedWriter &operator<<(double value);
+};
+
+#endif //BUFFERED_WRITER_H
@@ -0,0 +1,267 @@
+/**
+ * @file CloneDetector.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "CloneDetector.h"
+#include "SharedTransformation.h"
+
+#include <algorithm>
+#include <deque>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+const uint64_t ROLLING_HASH_BASE = 1099511628211ULL;
+
+/**
+ * @struct DiagonalHash
+ * @details Hash Of A (Function Pair, Offset Between Copies) Diagonal
+ */
+struct DiagonalHash {
+    size_t operator()(const pair<uint64_t, int> &diagonal) const {
+        return hash<uint64_t>()(diagonal.first * ROLLING_HASH_BASE + uint32_t(diagonal.second));
+    }
+};
+
+const unordered_set<string_view> cppKeywords = {
+        "alignas", "alignof", "auto", "bool", "break", "case", "catch", "char", "class", "const", "constexpr",
+        "const_cast", "continue", "decltype", "default", "delete", "do", "double", "dynamic_cast", "else", "enum",
+        "explicit", "extern", "false", "float", "for", "friend", "goto", "if", "inline", "int", "long", "mutable",
+        "namespace", "new", "noexcept", "nullptr", "operator", "private", "protected", "public", "register",
+        "reinterpret_cast", "return", "short", "signed", "sizeof", "static", "static_assert", "static_cast",
+        "struct", "switch", "template", "this", "throw", "true", "try", "typedef", "typename", "union", "unsigned",
+        "using", "virtual", "void", "volatile", "while"};
+
+CloneDetector::CloneDetector(int minimumTokens) {
+    minTokens = max(minimumTokens, CLONE_KGRAM_SIZE + CLONE_WINNOW_SIZE - 1);
+}
+
+uint64_t CloneDetector::normalizedHash(const SourceToken &token) {
+    static const uint64_t identifierHash = hashBytes("$identifier"), numberHash = hashBytes("$number");
+    static const uint64_t stringHash = hashBytes("$string"), characterHash = hashBytes("$character");
+    switch (token.kind) {
+        case TOKEN_IDENTIFIER:
+            return cppKeywords.contains(token.text) ? hashBytes(token.text) : identifierHash;
+        case TOKEN_NUMBER:
+            return numberHash;
+        case TOKEN_STRING:
+            return stringHash;
+        case TOKEN_CHARACTER:
+            return characterHash;
+        default:
+            return hashBytes(token.text);
+    }
+}
+
+bool CloneDetector::isNormalizedEqual(const SourceToken &firstToken, const SourceToken &secondToken) {
+    if (firstToken.text == secondToken.text) {
+        return true;
+    }
+    if (firstToken.kind != secondToken.kind) {
+        return false;
+    }
+    switch (firstToken.kind) {
+        case TOKEN_IDENTIFIER:
+            return !cppKeywords.contains(firstToken.text) && !cppKeywords.contains(secondToken.text);
+        case TOKEN_NUMBER:
+        case TOKEN_STRING:
+        case TOKEN_CHARACTER:
+            return true;
+        default:
+            return false;
+    }
+}
+
+int CloneDetector::addFunction(span<const SourceToken> tokens) {
+    for (const SourceToken &token: tokens) {
+        if (token.kind == TOKEN_COMMENT || token.kind == TOKEN_PREPROCESSOR) {
+            continue;
+        }
+        tokenHashes.push_back(normalizedHash(token));
+        tokenLines.push_back(token.lineNumber);
+    }
+    functionStarts.push_back(int(tokenHashes.size()));
+    int function = int(functionStarts.size()) - 2;
+    winnowFunction(function);
+    return function;
+}
+
+void CloneDetector::winnowFunction(int function) {
+    int begin = functionStarts[function], end = functionStarts[function + 1];
+    int numOfWindows = end - begin - CLONE_KGRAM_SIZE + 1;
+    if (numOfWindows <= 0) {
+        return;
+    }
+
+    uint64_t leadingPower = 1;
+    for (int j = 1; j < CLONE_KGRAM_SIZE; j++) {
+        leadingPower *= ROLLING_HASH_BASE;
+    }
+    vector<uint64_t> windowHashes(numOfWindows);
+    uint64_t rollingHash = 0;
+    for (int j = 0; j < CLONE_KGRAM_SIZE; j++) {
+        rollingHash = rollingHash * ROLLING_HASH_BASE + tokenHashes[begin + j];
+    }
+    windowHashes[0] = rollingHash;
+    for (int i = 1; i < numOfWindows; i++) {
+        rollingHash = (rollingHash - tokenHashes[begin + i - 1] * leadingPower) * ROLLING_HASH_BASE +
+                      tokenHashes[begin + i + CLONE_KGRAM_SIZE - 1];
+        windowHashes[i] = rollingHash;
+    }
+
+    // Minimum Candidates In Increasing Hash Order, Equal Hashes Replaced So The Rightmost Minimum Wins
+    deque<int> minimumQueue = {};
+    int windowSize = min(CLONE_WINNOW_SIZE, numOfWindows);
+    int lastSelected = -1;
+    for (int r = 0; r < numOfWindows; r++) {
+        while (!minimumQueue.empty() && windowHashes[minimumQueue.back()] >= windowHashes[r]) {
+            minimumQueue.pop_back();
+        }
+        minimumQueue.push_back(r);
+        if (minimumQueue.front() <= r - windowSize) {
+            minimumQueue.pop_front();
+        }
+        if (r >= windowSize - 1 && minimumQueue.front() != lastSelected) {
+            lastSelected = minimumQueue.front();
+            fingerprints.emplace_back(windowHashes[lastSelected], begin + lastSelected);
+            fingerprintFunctions.push_back(function);
+        }
+    }
+}
+
+CloneRegion CloneDetector::extendSeed(int position1, int position2, int function1, int function2) const {
+    int offset = position2 - position1;
+    int lowest1 = functionStarts[function1], highest1 = functionStarts[function1 + 1];
+    int lowest2 = functionStarts[function2], highest2 = functionStarts[function2 + 1];
+
+    // Both Copies Stay Inside Their Functions And Never Overlap Each Other
+    int begin1 = position1, end1 = position1;
+    while (begin1 > lowest1 && begin1 - 1 + offset >= lowest2 && end1 - begin1 < offset &&
+           tokenHashes[begin1 - 1] == tokenHashes[begin1 - 1 + offset]) {
+        begin1 -= 1;
+    }
+    while (end1 < highest1 && end1 + offset < highest2 && end1 - begin1 < offset &&
+           tokenHashes[end1] == tokenHashes[end1 + offset]) {
+        end1 += 1;
+    }
+    return {function1, function2, begin1, begin1 + offset, end1 - begin1};
+}
+
+vector<CloneRegion> CloneDetector::findClones() const {
+    unordered_map<uint64_t, int> bucketSizes = {};
+    for (const pair<uint64_t, int> &fingerprint: fingerprints) {
+        bucketSizes[fingerprint.first] += 1;
+    }
+
+    // Each Fingerprint Links To The Previous One With The Same Hash, Its Bucket Read Back To Front
+    unordered_map<uint64_t, int> lastInBucket = {};
+    vector<int> previousInBucket(fingerprints.size(), -1);
+    // (Function Pair, Offset Between Copies) -> End Of The Last Region Found, Seeds Inside It Are Skipped
+    unordered_map<pair<uint64_t, int>, int, DiagonalHash> coveredUntil = {};
+    vector<CloneRegion> clones = {};
+
+    for (int i = 0; i < int(fingerprints.size()); i++) {
+        uint64_t fingerprintHash = fingerprints[i].first;
+        if (bucketSizes[fingerprintHash] > CLONE_MAX_BUCKET) {
+            continue;
+        }
+        auto inserted = lastInBucket.try_emplace(fingerprintHash, i);
+        if (!inserted.second) {
+            previousInBucket[i] = inserted.first->second;
+            inserted.first->second = i;
+        }
+
+        int position2 = fingerprints[i].second, function2 = fingerprintFunctions[i];
+        for (int j = previousInBucket[i]; j >= 0; j = previousInBucket[j]) {
+            int position1 = fingerprints[j].second, function1 = fingerprintFunctions[j];
+            int offset = position2 - position1;
+            if (function1 == function2 && offset < minTokens) {
+                continue;
+            }
+            pair<uint64_t, int> diagonal = {(uint64_t(uint32_t(function1)) << 32) | uint32_t(function2), offset};
+            auto covered = coveredUntil.find(diagonal);
+            if (covered != coveredUntil.end() && position2 < covered->second) {
+                continue;
+            }
+            CloneRegion region = extendSeed(position1, position2, function1, function2);
+            coveredUntil[diagonal] = max(position2 + 1, region.tokenBegin2 + region.numOfTokens);
+            if (region.numOfTokens >= minTokens) {
+                clones.push_back(region);
+            }
+        }
+    }
+
+    return mergeRegions(std::move(clones));
+}
+
+vector<CloneRegion> CloneDetector::mergeRegions(vector<CloneRegion> clones) {
+    auto getPair = [](const CloneRegion &region) {
+        return (uint64_t(uint32_t(region.function1)) << 32) | uint32_t(region.function2);
+    };
+    auto getOffset = [](const CloneRegion &region) {
+        return region.tokenBegin2 - region.tokenBegin1;
+    };
+
+    // Regions Of One Diagonal Meet When They Overlap Or Touch, Copies In One Function Must Still Stay Apart
+    sort(clones.begin(), clones.end(), [&](const CloneRegion &a, const CloneRegion &b) {
+        return tuple(getPair(a), getOffset(a), a.tokenBegin1) < tuple(getPair(b), getOffset(b), b.tokenBegin1);
+    });
+    vector<CloneRegion> merged = {};
+    for (const CloneRegion &region: clones) {
+        if (!merged.empty()) {
+            CloneRegion &last = merged.back();
+            int mergedEnd = max(last.tokenBegin1 + last.numOfTokens, region.tokenBegin1 + region.numOfTokens);
+            if (getPair(last) == getPair(region) && getOffset(last) == getOffset(region) &&
+                region.tokenBegin1 <= last.tokenBegin1 + last.numOfTokens &&
+                (region.function1 != region.function2 || mergedEnd - last.tokenBegin1 <= getOffset(region))) {
+                last.numOfTokens = mergedEnd - last.tokenBegin1;
+                continue;
+            }
+        }
+        merged.push_back(region);
+    }
+
+    // Longest First, A Region Whose Copies Both Overlap Those Of A Kept Region Repeats It, As Does A Region Of
+    // One Function Lying Wholly Within The Stretch A Kept Region's Two Copies Span
+    stable_sort(merged.begin(), merged.end(), [](const CloneRegion &a, const CloneRegion &b) {
+        return a.numOfTokens > b.numOfTokens;
+    });
+    auto isOverlapping = [](int begin1, int begin2, int numOfTokens1, int numOfTokens2) {
+        return begin1 < begin2 + numOfTokens2 && begin2 < begin1 + numOfTokens1;
+    };
+    unordered_map<uint64_t, vector<CloneRegion>> keptByPair = {};
+    vector<CloneRegion> kept = {};
+    for (const CloneRegion &region: merged) {
+        vector<CloneRegion> &pairKept = keptByPair[getPair(region)];
+        bool isRepeated = any_of(pairKept.begin(), pairKept.end(), [&](const CloneRegion &other) {
+            if (region.function1 == region.function2 && region.tokenBegin1 >= other.tokenBegin1 &&
+                region.tokenBegin2 + region.numOfTokens <= other.tokenBegin2 + other.numOfTokens) {
+                return true;
+            }
+            return isOverlapping(region.tokenBegin1, other.tokenBegin1, region.numOfTokens, other.numOfTokens) &&
+                   isOverlapping(region.tokenBegin2, other.tokenBegin2, region.numOfTokens, other.numOfTokens);
+        });
+        if (!isRepeated) {
+            pairKept.push_back(region);
+            kept.push_back(region);
+        }
+    }
+
+    sort(kept.begin(), kept.end(), [](const CloneRegion &a, const CloneRegion &b) {
+        if (a.function1 != b.function1) {
+            return a.function1 < b.function1;
+        }
+        if (a.tokenBegin1 != b.tokenBegin1) {
+            return a.tokenBegin1 < b.tokenBegin1;
+        }
+        return a.tokenBegin2 < b.tokenBegin2;
+    });
+    return kept;
+}
+
+int CloneDetector::getTokenLine(int position) const {
+    return tokenLines.at(position);
+}
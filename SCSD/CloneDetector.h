@@ -0,0 +1,136 @@
+/**
+ * @file CloneDetector.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Fragment Level Clone Detection: Rolling Hashes Of Normalized Token Windows, Winnowed Into Fingerprints
+ */
+
+#ifndef CLONE_DETECTOR_H
+#define CLONE_DETECTOR_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "SourceLexer.h"
+
+using namespace std;
+
+// Tokens Per Rolling Hash Window
+const int CLONE_KGRAM_SIZE = 12;
+// Windows Per Winnowing Window, Any Match Of CLONE_KGRAM_SIZE + CLONE_WINNOW_SIZE - 1 Tokens Shares A Fingerprint
+const int CLONE_WINNOW_SIZE = 8;
+// Shortest Clone Reported, In Normalized Tokens
+const int CLONE_MIN_TOKENS = 50;
+// Fingerprints Found More Often Than This Are Boilerplate, Not Used As Seeds
+const int CLONE_MAX_BUCKET = 64;
+
+/**
+ * @struct CloneRegion
+ * @details Two Equal Runs Of Normalized Tokens, Positions Index The Detector's Token Stream
+ */
+struct CloneRegion {
+    int function1 = 0;
+    int function2 = 0;
+    int tokenBegin1 = 0;
+    int tokenBegin2 = 0;
+    int numOfTokens = 0;
+};
+
+/**
+ * @class CloneDetector
+ * @details Identifiers And Literals Are Normalized Away So Renamed Copies Still Match, Fingerprints Are Indexed
+ * By Hash And Every Shared One Seeds A Match That Is Extended Token By Token, Linear Apart From The Output
+ */
+class CloneDetector {
+private:
+    // Normalized Token Hashes Of Every Function, Concatenated
+    vector<uint64_t> tokenHashes = {};
+    // Line Of Each Normalized Token
+    vector<int> tokenLines = {};
+    // Function f Owns Tokens [functionStarts[f], functionStarts[f + 1])
+    vector<int> functionStarts = {0};
+    // Winnowed k-Gram Hashes And The Token Position Each Window Starts At
+    vector<pair<uint64_t, int>> fingerprints = {};
+    // Function Owning Each Fingerprint
+    vector<int> fingerprintFunctions = {};
+    // Shortest Clone Reported
+    int minTokens = CLONE_MIN_TOKENS;
+
+    /**
+     * winnowFunction() Rolling Hash Every k-Gram Of One Function, Keep The Rightmost Minimum Of Each Window
+     *
+     * @param function Int
+     */
+    void winnowFunction(int function);
+
+    /**
+     * extendSeed() Grow A Shared Fingerprint Into The Longest Equal Run Around It, Within Both Functions
+     *
+     * @param position1 Int
+     * @param position2 Int, After position1
+     * @param function1 Int
+     * @param function2 Int
+     * @return CloneRegion
+     */
+    CloneRegion extendSeed(int position1, int position2, int function1, int function2) const;
+
+    /**
+     * mergeRegions() Join Regions That Overlap On One Diagonal, Then Drop Every Region Overlapping A Longer One Of
+     * The Same Function Pair In Both Copies, Repetitive Code Otherwise Reports One Clone Many Times
+     *
+     * @param clones vector<CloneRegion>
+     * @return vector<CloneRegion>, Sorted By First Function And Position
+     */
+    static vector<CloneRegion> mergeRegions(vector<CloneRegion> clones);
+
+public:
+    /**
+     * CloneDetector() Constructor To Create Instance of CloneDetector
+     *
+     * @param minimumTokens Int, Shortest Clone Reported, At Least The Length Winnowing Guarantees To Find
+     */
+    explicit CloneDetector(int minimumTokens = CLONE_MIN_TOKENS);
+
+    /**
+     * normalizedHash() Hash Of A Token With Identifiers (Keywords Aside) And Literals Replaced By Their Kind
+     *
+     * @param token SourceToken, Not A Comment Or Preprocessor Line, Those Are Dropped
+     * @return uint64_t
+     */
+    static uint64_t normalizedHash(const SourceToken &token);
+
+    /**
+     * isNormalizedEqual() Whether Two Tokens Are The Same Once Normalized As normalizedHash() Does, Compared Exactly
+     *
+     * @param firstToken SourceToken
+     * @param secondToken SourceToken
+     * @return Boolean
+     */
+    static bool isNormalizedEqual(const SourceToken &firstToken, const SourceToken &secondToken);
+
+    /**
+     * addFunction() Normalize And Fingerprint The Tokens Of One Function
+     *
+     * @param tokens span<const SourceToken>
+     * @return Int Index Of The Function
+     */
+    int addFunction(span<const SourceToken> tokens);
+
+    /**
+     * findClones() Maximal Equal Regions Of At Least The Minimum Length, Between Or Within Functions
+     *
+     * @return vector<CloneRegion>, Sorted By First Function And Position
+     */
+    vector<CloneRegion> findClones() const;
+
+    /**
+     * getTokenLine() Source Line Of A Normalized Token
+     *
+     * @param position Int
+     * @return Int
+     */
+    int getTokenLine(int position) const;
+};
+
+#endif //CLONE_DETECTOR_H
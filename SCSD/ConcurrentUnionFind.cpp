@@ -0,0 +1,85 @@
+/**
+ * @file ConcurrentUnionFind.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "ConcurrentUnionFind.h"
+
+#include <utility>
+
+ConcurrentUnionFind::ConcurrentUnionFind(int elements) : numOfElements(elements),
+                                                         parents(make_unique<atomic<int>[]>(size_t(elements))) {
+    for (int i = 0; i < numOfElements; i++) {
+        parents[i].store(i, memory_order_relaxed);
+    }
+}
+
+int ConcurrentUnionFind::find(int element) {
+    while (true) {
+        int parent = parents[element].load(memory_order_acquire);
+        if (parent == element) {
+            return element;
+        }
+        int grandParent = parents[parent].load(memory_order_acquire);
+        if (grandParent != parent) {
+            // Path Halving, Losing The Race Only Means Another Thread Shortened It
+            parents[element].compare_exchange_weak(parent, grandParent, memory_order_acq_rel);
+        }
+        element = grandParent;
+    }
+}
+
+bool ConcurrentUnionFind::unite(int element1, int element2) {
+    while (true) {
+        int root1 = find(element1), root2 = find(element2);
+        if (root1 == root2) {
+            return false;
+        }
+        if (root1 < root2) {
+            swap(root1, root2);
+        }
+        // Fails When root1 Stopped Being A Root Meanwhile, Then Both Roots Are Found Again
+        int expected = root1;
+        if (parents[root1].compare_exchange_strong(expected, root2, memory_order_acq_rel)) {
+            return true;
+        }
+    }
+}
+
+bool ConcurrentUnionFind::isSameSet(int element1, int element2) {
+    while (true) {
+        int root1 = find(element1), root2 = find(element2);
+        if (root1 == root2) {
+            return true;
+        }
+        // Different Roots Are Only Proof While root1 Is Still A Root
+        if (parents[root1].load(memory_order_acquire) == root1) {
+            return false;
+        }
+    }
+}
+
+vector<vector<int>> ConcurrentUnionFind::getClasses() {
+    vector<int> roots(numOfElements);
+    vector<int> setSizes(size_t(numOfElements), 0);
+    for (int i = 0; i < numOfElements; i++) {
+        roots[i] = find(i);
+        setSizes[roots[i]] += 1;
+    }
+    // Every Root Is Its Set's Smallest Element, Classes Come Out In Order Of It
+    vector<int> classOfRoot(size_t(numOfElements), -1);
+    vector<vector<int>> cloneClasses = {};
+    for (int i = 0; i < numOfElements; i++) {
+        if (setSizes[roots[i]] < 2) {
+            continue;
+        }
+        if (classOfRoot[roots[i]] < 0) {
+            classOfRoot[roots[i]] = int(cloneClasses.size());
+            cloneClasses.emplace_back();
+            cloneClasses.back().reserve(setSizes[roots[i]]);
+        }
+        cloneClasses[classOfRoot[roots[i]]].push_back(i);
+    }
+    return cloneClasses;
+}
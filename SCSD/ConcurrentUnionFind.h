@@ -0,0 +1,72 @@
+/**
+ * @file ConcurrentUnionFind.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Lock-Free Disjoint Sets, Grouping Duplicate Functions Into Clone Classes From Several Threads
+ */
+
+#ifndef CONCURRENT_UNION_FIND_H
+#define CONCURRENT_UNION_FIND_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class ConcurrentUnionFind
+ * @details A Root Is Only Ever Linked Under A Smaller Root With Compare-And-Swap, So Parents Never Increase And Sets
+ * Stay Acyclic Under Concurrent unite() And find(), Which Halves Paths As It Walks
+ */
+class ConcurrentUnionFind {
+private:
+    int numOfElements;
+    // Parent Of Each Element, Itself For A Root
+    unique_ptr<atomic<int>[]> parents;
+
+public:
+    /**
+     * ConcurrentUnionFind() Constructor To Create Instance of ConcurrentUnionFind, Each Element In Its Own Set
+     *
+     * @param elements Int
+     */
+    explicit ConcurrentUnionFind(int elements);
+
+    /**
+     * find() Root Of An Element's Set
+     *
+     * @param element Int
+     * @return Int
+     */
+    int find(int element);
+
+    /**
+     * unite() Merge The Sets Of Two Elements
+     *
+     * @param element1 Int
+     * @param element2 Int
+     * @return Boolean, False When They Were Already In One Set
+     */
+    bool unite(int element1, int element2);
+
+    /**
+     * isSameSet() Whether Two Elements Are Already In One Set
+     *
+     * @param element1 Int
+     * @param element2 Int
+     * @return Boolean
+     */
+    bool isSameSet(int element1, int element2);
+
+    /**
+     * getClasses() Sets Of At Least Two Elements, Each Sorted, Ordered By Their Smallest Element; Call Once Every
+     * unite() Has Returned
+     *
+     * @return vector<vector<int>>
+     */
+    vector<vector<int>> getClasses();
+};
+
+#endif //CONCURRENT_UNION_FIND_H
@@ -0,0 +1,105 @@
+/**
+ * @file CorpusGenerator.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "CorpusGenerator.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+const vector<string> corpusParamTypes = {"int", "double", "size_t", "bool", "const string &"};
+const vector<string> corpusOperators = {"+", "-", "*", "^", "&", "|"};
+
+CorpusGenerator::CorpusGenerator(const CorpusSettings &corpusSettings) : settings(corpusSettings) {
+    settings.funcsPerFile = max(1, settings.funcsPerFile);
+    settings.bodyLength = max(1, settings.bodyLength);
+    settings.maxParams = max(0, settings.maxParams);
+}
+
+string CorpusGenerator::getFunctionName(int funcIndex) {
+    return "fn" + to_string(funcIndex);
+}
+
+void CorpusGenerator::appendFunction(string &fileText, int funcIndex, int contentIndex) const {
+    // Seeded By The Content's Index, A Copy Regenerates Its Original Without Keeping It
+    mt19937_64 contentRandom(settings.seed * 0x9E3779B97F4A7C15ULL + uint64_t(contentIndex));
+    uniform_int_distribution<int> pickWord(0, CORPUS_VOCABULARY_SIZE - 1);
+    uniform_int_distribution<int> pickLiteral(0, 99);
+    auto nextWord = [&]() { return "w" + to_string(pickWord(contentRandom)); };
+    auto nextOperator = [&]() { return corpusOperators[contentRandom() % corpusOperators.size()]; };
+
+    int numOfParams = int(contentRandom() % uint64_t(settings.maxParams + 1));
+    fileText += "int " + getFunctionName(funcIndex) + "(";
+    for (int p = 0; p < numOfParams; p++) {
+        fileText += (p > 0 ? ", " : "") + corpusParamTypes[contentRandom() % corpusParamTypes.size()] + " p" +
+                    to_string(p);
+    }
+    fileText += ") {\n";
+
+    int minLength = max(1, settings.bodyLength / 2);
+    int numOfLines = minLength + int(contentRandom() % uint64_t(settings.bodyLength + 1));
+    string resultWord = nextWord();
+    for (int line = 0; line < numOfLines;) {
+        uint64_t lineKind = contentRandom() % 8;
+        if (lineKind == 0 && line + 3 <= numOfLines) {
+            fileText += "    if (" + nextWord() + " > " + nextWord() + ") {\n";
+            fileText += "        " + resultWord + " -= " + nextWord() + ";\n";
+            fileText += "    }\n";
+            line += 3;
+        } else if (lineKind == 1 && line + 3 <= numOfLines) {
+            fileText += "    for (int k = 0; k < " + nextWord() + "; k++) {\n";
+            fileText += "        " + nextWord() + " += k;\n";
+            fileText += "    }\n";
+            line += 3;
+        } else {
+            fileText += "    " + nextWord() + " = " + nextWord() + " " + nextOperator() + " " + nextWord() + " " +
+                        nextOperator() + " " + to_string(pickLiteral(contentRandom)) + ";\n";
+            line += 1;
+        }
+    }
+    fileText += "    return " + resultWord + ";\n}\n";
+}
+
+int CorpusGenerator::generate(const string &directory) {
+    error_code createError;
+    fs::create_directories(directory, createError);
+    plantedDuplicates.clear();
+
+    mt19937_64 corpusRandom(settings.seed);
+    uniform_real_distribution<double> pickChance(0.0, 1.0);
+    // Only Originals Are Copied, Each Planted Pair Is Then The Only Reason Its Two Functions Match
+    vector<int> originals = {};
+    int numOfFiles = 0;
+    string fileText;
+    for (int fileStart = 0; fileStart < settings.numOfFunctions; fileStart += settings.funcsPerFile) {
+        fileText.clear();
+        int fileEnd = min(settings.numOfFunctions, fileStart + settings.funcsPerFile);
+        for (int funcIndex = fileStart; funcIndex < fileEnd; funcIndex++) {
+            int contentIndex = funcIndex;
+            if (!originals.empty() && pickChance(corpusRandom) < settings.duplicateRate) {
+                contentIndex = originals[corpusRandom() % originals.size()];
+                plantedDuplicates.emplace_back(contentIndex, funcIndex);
+            } else {
+                originals.push_back(funcIndex);
+            }
+            appendFunction(fileText, funcIndex, contentIndex);
+        }
+
+        ofstream sourceFile(fs::path(directory) / ("gen" + to_string(numOfFiles) + ".cpp"), ios::trunc);
+        sourceFile.write(fileText.data(), streamsize(fileText.size()));
+        if (!sourceFile.flush()) {
+            return -1;
+        }
+        numOfFiles += 1;
+    }
+    return numOfFiles;
+}
+
+const vector<pair<int, int>> &CorpusGenerator::getPlantedDuplicates() const {
+    return plantedDuplicates;
+}
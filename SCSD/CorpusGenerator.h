@@ -0,0 +1,92 @@
+/**
+ * @file CorpusGenerator.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Synthetic C++-Like Source Corpus With Planted Duplicate Functions, For Benchmarking Scans
+ */
+
+#ifndef CORPUS_GENERATOR_H
+#define CORPUS_GENERATOR_H
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+const int CORPUS_VOCABULARY_SIZE = 32768;
+const int CORPUS_DEFAULT_FILE_FUNCTIONS = 1000;
+
+/**
+ * @struct CorpusSettings
+ * @details Shape Of A Generated Corpus
+ */
+struct CorpusSettings {
+    int numOfFunctions = 1000;
+    // Functions Written To Each File, The Last File Holds The Rest
+    int funcsPerFile = CORPUS_DEFAULT_FILE_FUNCTIONS;
+    // Average Body Lines, Bodies Vary Between Half And One And A Half Times It
+    int bodyLength = 12;
+    // Parameter Counts Are Uniform In [0, maxParams]
+    int maxParams = 5;
+    // Chance That A Function Is A Renamed Copy Of An Earlier One
+    double duplicateRate = 0.01;
+    uint64_t seed = 1;
+};
+
+/**
+ * @class CorpusGenerator
+ * @details Writes Functions Named fn<index> Whose Bodies Draw Identifiers From A Large Vocabulary, So Unrelated
+ * Functions Share Few Tokens, A Planted Duplicate Repeats An Earlier Function's Parameters And Body Under Its Own Name
+ */
+class CorpusGenerator {
+private:
+    CorpusSettings settings;
+    // (Original, Copy) Function Indexes, Original First
+    vector<pair<int, int>> plantedDuplicates = {};
+
+    /**
+     * appendFunction() Write One Function, Its Parameters And Body Generated From contentIndex Alone
+     *
+     * @param fileText String
+     * @param funcIndex Int, Names The Function
+     * @param contentIndex Int, The Function Whose Content Is Written, funcIndex Unless It Is A Copy
+     */
+    void appendFunction(string &fileText, int funcIndex, int contentIndex) const;
+
+public:
+    /**
+     * CorpusGenerator() Constructor To Create Instance of CorpusGenerator
+     *
+     * @param corpusSettings CorpusSettings
+     */
+    explicit CorpusGenerator(const CorpusSettings &corpusSettings);
+
+    /**
+     * generate() Write The Corpus As gen<N>.cpp Files Into A Directory, Created If Needed
+     *
+     * @param directory String
+     * @return Int Number of Files Written, -1 When A File Cannot Be Written
+     */
+    int generate(const string &directory);
+
+    /**
+     * getPlantedDuplicates() Duplicate Pairs Planted By The Last generate()
+     *
+     * @return vector<pair<int, int>> Function Indexes
+     */
+    const vector<pair<int, int>> &getPlantedDuplicates() const;
+
+    /**
+     * getFunctionName() Bare Name Of A Generated Function
+     *
+     * @param funcIndex Int
+     * @return String
+     */
+    static string getFunctionName(int funcIndex);
+};
+
+#endif //CORPUS_GENERATOR_H
@@ -0,0 +1,322 @@
+/**
+ * @file ExternalScan.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "ExternalScan.h"
+#include "ConcurrentUnionFind.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <limits>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+// Metric Reports In Spill File Order
+const ReportType metricReports[NUM_OF_METRIC_REPORTS] = {REPORT_LONG_FUNCS, REPORT_LONG_PARAMS, REPORT_COMPLEX_FUNCS};
+
+ExternalScan::ExternalScan(RepositoryScanner &repositoryScanner, const string &spillDirectory, size_t memoryBytes)
+        : scanner(repositoryScanner), memoryCap(memoryBytes) {
+    workDirectory = (fs::path(spillDirectory) / ("scsd-" + to_string(getpid()))).string();
+    error_code createError;
+    fs::create_directories(workDirectory, createError);
+
+    functionRecords.open(getWorkPath("functions.bin"), ios::binary | ios::trunc);
+    functionOffsets.open(getWorkPath("offsets.bin"), ios::binary | ios::trunc);
+    for (int r = 0; r < NUM_OF_METRIC_REPORTS; r++) {
+        metricResults[r].open(getWorkPath("report" + to_string(r) + ".bin"), ios::binary | ios::trunc);
+    }
+    // The Candidate Pairs Are Sorted While The Band Keys Are Merged, Each Gets Half
+    bandKeys = make_unique<ExternalSorter<BandKeyRecord>>(workDirectory, "keys", memoryCap / 2);
+}
+
+ExternalScan::~ExternalScan() {
+    if (recordsDescriptor >= 0) {
+        close(recordsDescriptor);
+    }
+    if (offsetsDescriptor >= 0) {
+        close(offsetsDescriptor);
+    }
+    bandKeys.reset();
+    functionRecords.close();
+    functionOffsets.close();
+    for (ofstream &results: metricResults) {
+        results.close();
+    }
+    error_code removeError;
+    fs::remove_all(workDirectory, removeError);
+}
+
+string ExternalScan::getWorkPath(const string &fileName) const {
+    return (fs::path(workDirectory) / fileName).string();
+}
+
+bool ExternalScan::hasSpillFailed() const {
+    return isSpillFailed;
+}
+
+bool ExternalScan::isUsable() const {
+    bool isOpen = functionRecords.is_open() && functionOffsets.is_open();
+    for (const ofstream &results: metricResults) {
+        isOpen = isOpen && results.is_open();
+    }
+    return isOpen;
+}
+
+void ExternalScan::setStatistics(AnalysisStatistics *statistics) {
+    analysisStatistics = statistics;
+}
+
+int ExternalScan::getNumOfFunctions() const {
+    return int(numOfFunc);
+}
+
+size_t ExternalScan::getWindowEnd(size_t firstFile) const {
+    const vector<string> &sourcePaths = scanner.getSourcePaths();
+    size_t windowBytes = memoryCap / EXTERNAL_PARSE_EXPANSION;
+    size_t lastFile = firstFile, sourceBytes = 0;
+    while (lastFile < sourcePaths.size() && lastFile - firstFile < EXTERNAL_FILE_WINDOW) {
+        error_code sizeError;
+        uintmax_t fileBytes = fs::file_size(sourcePaths[lastFile], sizeError);
+        sourceBytes += sizeError ? 0 : size_t(fileBytes);
+        if (lastFile > firstFile && sourceBytes > windowBytes) {
+            break;
+        }
+        lastFile += 1;
+    }
+    return lastFile;
+}
+
+bool ExternalScan::scanFiles() {
+    const vector<string> &sourcePaths = scanner.getSourcePaths();
+    for (size_t firstFile = 0, lastFile = 0; firstFile < sourcePaths.size(); firstFile = lastFile) {
+        lastFile = getWindowEnd(firstFile);
+        vector<unique_ptr<FunctionExtrapolation>> fileResults = scanner.parseFiles(firstFile, lastFile);
+        for (size_t i = 0; i < fileResults.size(); i++) {
+            if (fileResults[i] != nullptr) {
+                if (!spillFunctions(std::move(*fileResults[i]), uint32_t(firstFile + i))) {
+                    isSpillFailed = true;
+                    return false;
+                }
+                fileResults[i].reset();
+            }
+        }
+    }
+
+    functionOffsets.write(reinterpret_cast<const char *>(&recordsEnd), sizeof(recordsEnd));
+    bool isWritten = bool(functionRecords.flush()) && bool(functionOffsets.flush());
+    for (ofstream &results: metricResults) {
+        isWritten = isWritten && bool(results.flush());
+        results.close();
+    }
+    functionRecords.close();
+    functionOffsets.close();
+    recordsDescriptor = open(getWorkPath("functions.bin").c_str(), O_RDONLY);
+    offsetsDescriptor = open(getWorkPath("offsets.bin").c_str(), O_RDONLY);
+    return isWritten && recordsDescriptor >= 0 && offsetsDescriptor >= 0;
+}
+
+bool ExternalScan::spillFunctions(FunctionExtrapolation &&fileFunctions, uint32_t pathIndex) {
+    FunctionExtrapolation fileIndex;
+    fileIndex.setStatistics(analysisStatistics);
+    // A One-File Index Gives Its Functions Their Path, As The Global Index Would
+    fileIndex.mergeFunctions(std::move(fileFunctions), scanner.getSourcePaths()[pathIndex]);
+    fileIndex.computeSignatures();
+
+    // Metric Results Are Found Before numOfFunc Moves Past This File
+    for (int r = 0; r < NUM_OF_METRIC_REPORTS; r++) {
+        vector<int> flaggedRows = fileIndex.findMetricRows(metricReports[r]);
+        for (int row: flaggedRows) {
+            MetricResultRecord result = {numOfFunc + uint32_t(row), fileIndex.getMetrics().getRow(row)};
+            metricResults[r].write(reinterpret_cast<const char *>(&result), sizeof(result));
+        }
+        numOfMetricResults[r] += int(flaggedRows.size());
+    }
+
+    const TokenPool &tokenPool = fileIndex.getTokenPool();
+    vector<uint64_t> tokenHashes = {};
+    for (const FunctionExpression &funcExpr: fileIndex.getFunctions()) {
+        // Token Ids Are Local To The File, Their Content Hashes Compare Across Files
+        tokenHashes.clear();
+        for (uint32_t tokenId: funcExpr.tokenSet) {
+            tokenHashes.push_back(tokenPool.getTokenHash(tokenId));
+        }
+        sort(tokenHashes.begin(), tokenHashes.end());
+        tokenHashes.erase(unique(tokenHashes.begin(), tokenHashes.end()), tokenHashes.end());
+        if (analysisStatistics != nullptr) {
+            analysisStatistics->recordTokenSetSize(int64_t(tokenHashes.size()));
+        }
+
+        SpilledRecordHeader header = {pathIndex, funcExpr.stLine, funcExpr.endLine,
+                                      uint32_t(funcExpr.funcName.size()), uint32_t(tokenHashes.size())};
+        functionOffsets.write(reinterpret_cast<const char *>(&recordsEnd), sizeof(recordsEnd));
+        functionRecords.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        functionRecords.write(funcExpr.funcName.data(), streamsize(funcExpr.funcName.size()));
+        functionRecords.write(reinterpret_cast<const char *>(tokenHashes.data()),
+                              streamsize(tokenHashes.size() * sizeof(uint64_t)));
+        recordsEnd += sizeof(header) + funcExpr.funcName.size() + tokenHashes.size() * sizeof(uint64_t);
+
+        for (size_t b = 0; b < funcExpr.signature.size(); b++) {
+            if (!bandKeys->add({funcExpr.signature[b], uint32_t(b), numOfFunc})) {
+                return false;
+            }
+        }
+        numOfFunc += 1;
+    }
+    return true;
+}
+
+bool ExternalScan::readFunction(uint32_t function, SpilledFunction &spilledFunction) const {
+    uint64_t recordRange[2];
+    if (pread(offsetsDescriptor, recordRange, sizeof(recordRange), off_t(function) * sizeof(uint64_t)) !=
+        ssize_t(sizeof(recordRange)) || recordRange[1] < recordRange[0] + sizeof(SpilledRecordHeader)) {
+        return false;
+    }
+    string record(recordRange[1] - recordRange[0], '\0');
+    if (pread(recordsDescriptor, record.data(), record.size(), off_t(recordRange[0])) != ssize_t(record.size())) {
+        return false;
+    }
+
+    SpilledRecordHeader header = {};
+    memcpy(&header, record.data(), sizeof(header));
+    if (sizeof(header) + header.nameLength + uint64_t(header.setSize) * sizeof(uint64_t) != record.size()) {
+        return false;
+    }
+    spilledFunction.fileIndex = header.fileIndex;
+    spilledFunction.stLine = header.stLine;
+    spilledFunction.endLine = header.endLine;
+    spilledFunction.funcName.assign(record, sizeof(header), header.nameLength);
+    spilledFunction.tokenHashes.resize(header.setSize);
+    memcpy(spilledFunction.tokenHashes.data(), record.data() + sizeof(header) + header.nameLength,
+           header.setSize * sizeof(uint64_t));
+    return true;
+}
+
+ReportLocation ExternalScan::getReportLocation(const SpilledFunction &spilledFunction) const {
+    return {spilledFunction.funcName, {}, scanner.getSourcePaths().at(spilledFunction.fileIndex),
+            spilledFunction.stLine, spilledFunction.endLine};
+}
+
+int ExternalScan::getMetricSlot(ReportType reportType) {
+    for (int r = 0; r < NUM_OF_METRIC_REPORTS; r++) {
+        if (metricReports[r] == reportType) {
+            return r;
+        }
+    }
+    return -1;
+}
+
+bool ExternalScan::findCloneClasses(vector<vector<int>> &classes) {
+    PhaseTimer duplicateTimer(analysisStatistics, PHASE_DUPLICATE);
+    ExternalSorter<CandidateRecord> candidatePairs(workDirectory, "pairs", memoryCap / 2);
+
+    // Every Pair Within A Run Of Equal (band, key) Is A Candidate, Runs Arrive With Their Functions Ascending
+    vector<uint32_t> bucket = {};
+    BandKeyRecord bucketKey = {};
+    bool isSpilled = true;
+    auto addBucketPairs = [&bucket, &candidatePairs, &isSpilled]() {
+        for (size_t i = 0; i + 1 < bucket.size() && isSpilled; i++) {
+            for (size_t j = i + 1; j < bucket.size() && isSpilled; j++) {
+                isSpilled = candidatePairs.add({bucket[i], bucket[j]});
+            }
+        }
+        bucket.clear();
+    };
+    isSpilled = bandKeys->merge([&](const BandKeyRecord &bandKey) {
+        if (!bucket.empty() && (bandKey.band != bucketKey.band || bandKey.key != bucketKey.key)) {
+            addBucketPairs();
+        }
+        bucketKey = bandKey;
+        bucket.push_back(bandKey.function);
+    }) && isSpilled;
+    addBucketPairs();
+    bandKeys.reset();
+    if (!isSpilled) {
+        return false;
+    }
+
+    // Pairs Arrive Grouped By Their First Function, Whose Token Set Is Read Once Per Group
+    ConcurrentUnionFind cloneClasses(static_cast<int>(numOfFunc));
+    CandidateRecord lastPair = {numeric_limits<uint32_t>::max(), numeric_limits<uint32_t>::max()};
+    uint32_t loadedFunction = numeric_limits<uint32_t>::max();
+    SpilledFunction firstFunction, secondFunction;
+    int64_t numOfConsidered = 0, numOfCompared = 0;
+    isSpilled = candidatePairs.merge([&](const CandidateRecord &candidate) {
+        if (candidate.first == lastPair.first && candidate.second == lastPair.second) {
+            return;
+        }
+        lastPair = candidate;
+        numOfConsidered += 1;
+        if (cloneClasses.isSameSet(int(candidate.first), int(candidate.second))) {
+            return;
+        }
+        if (candidate.first != loadedFunction) {
+            loadedFunction = readFunction(candidate.first, firstFunction) ? candidate.first
+                                                                          : numeric_limits<uint32_t>::max();
+        }
+        if (loadedFunction != candidate.first || !readFunction(candidate.second, secondFunction)) {
+            return;
+        }
+        numOfCompared += 1;
+        if (getJaccardSimilarIndex(span<const uint64_t>(firstFunction.tokenHashes),
+                                   span<const uint64_t>(secondFunction.tokenHashes)) >= JACCARD_INDEX_THRESHOLD) {
+            cloneClasses.unite(int(candidate.first), int(candidate.second));
+        }
+    });
+    if (!isSpilled) {
+        return false;
+    }
+
+    if (analysisStatistics != nullptr) {
+        analysisStatistics->addCandidates(numOfConsidered, numOfConsidered - numOfCompared, numOfCompared);
+    }
+    classes = cloneClasses.getClasses();
+    return true;
+}
+
+bool ExternalScan::writeReport(ReportType reportType, ReportSink &reportSink) {
+    int metricSlot = getMetricSlot(reportType);
+    if (metricSlot < 0 && reportType != REPORT_DUPLICATES) {
+        return false;
+    }
+    if (reportType == REPORT_DUPLICATES && !hasCloneClasses) {
+        if (!findCloneClasses(cloneClasses)) {
+            isSpillFailed = true;
+            return false;
+        }
+        hasCloneClasses = true;
+    }
+
+    reportSink.beginReport(reportType);
+    SpilledFunction spilledFunction;
+    int numOfResults = 0;
+    if (reportType == REPORT_DUPLICATES) {
+        vector<SpilledFunction> members = {};
+        vector<ReportLocation> memberLocations = {};
+        for (size_t c = 0; c < cloneClasses.size(); c++) {
+            members.resize(cloneClasses[c].size());
+            memberLocations.clear();
+            for (size_t m = 0; m < members.size(); m++) {
+                readFunction(uint32_t(cloneClasses[c][m]), members[m]);
+                memberLocations.push_back(getReportLocation(members[m]));
+            }
+            reportSink.addCloneClass(int(c) + 1, memberLocations);
+        }
+        numOfResults = int(cloneClasses.size());
+    } else {
+        // Results Are Streamed From Disk, Never Gathered
+        ifstream results(getWorkPath("report" + to_string(metricSlot) + ".bin"), ios::binary);
+        MetricResultRecord result = {};
+        while (results.read(reinterpret_cast<char *>(&result), sizeof(result))) {
+            if (readFunction(result.function, spilledFunction)) {
+                reportSink.addMetricResult(reportType, getReportLocation(spilledFunction), result.metrics);
+            }
+        }
+        numOfResults = numOfMetricResults[metricSlot];
+    }
+    reportSink.endReport(reportType, numOfResults);
+    return true;
+}
@@ -0,0 +1,256 @@
+/**
+ * @file ExternalScan.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Repository Scan Holding A Bounded Window Of Files In Memory, Everything Else Spilled To Disk
+ */
+
+#ifndef EXTERNAL_SCAN_H
+#define EXTERNAL_SCAN_H
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "AnalysisStatistics.h"
+#include "ExternalSorter.h"
+#include "FunctionExtrapolation.h"
+#include "RepositoryScanner.h"
+
+using namespace std;
+
+const size_t EXTERNAL_DEFAULT_MEMORY_CAP = size_t(256) << 20;
+// Most Files Parsed Together Before Their Functions Are Spilled
+const size_t EXTERNAL_FILE_WINDOW = 32;
+// A Parsed File Takes About This Many Times Its Size, A Window's Source Is Kept Under The Cap Divided By It
+const size_t EXTERNAL_PARSE_EXPANSION = 8;
+const int NUM_OF_METRIC_REPORTS = 3;
+
+/**
+ * @struct BandKeyRecord
+ * @details One LSH Band Key Of A Function's MinHash Signature, Functions Sharing A (band, key) Are Candidates
+ */
+struct BandKeyRecord {
+    uint64_t key;
+    uint32_t band;
+    uint32_t function;
+
+    bool operator<(const BandKeyRecord &other) const {
+        return tie(band, key, function) < tie(other.band, other.key, other.function);
+    }
+};
+
+/**
+ * @struct SpilledRecordHeader
+ * @details Start Of A Function's Record, Followed By Its Name And Its Token Hash Set
+ */
+struct SpilledRecordHeader {
+    // Index Into The Scanner's Source Paths
+    uint32_t fileIndex;
+    int32_t stLine;
+    int32_t endLine;
+    uint32_t nameLength;
+    uint32_t setSize;
+};
+
+/**
+ * @struct SpilledFunction
+ * @details A Function Read Back From Its Record
+ */
+struct SpilledFunction {
+    uint32_t fileIndex = 0;
+    int32_t stLine = 0;
+    int32_t endLine = 0;
+    string funcName;
+    // Content Hashes Of Its Tokens, Sorted Without Repeats
+    vector<uint64_t> tokenHashes = {};
+};
+
+/**
+ * @struct MetricResultRecord
+ * @details A Function Flagged By A Metric Report, With Its Metrics
+ */
+struct MetricResultRecord {
+    uint32_t function;
+    MetricsRow metrics;
+};
+
+/**
+ * @struct CandidateRecord
+ * @details A Candidate Pair Of Functions, first < second
+ */
+struct CandidateRecord {
+    uint32_t first;
+    uint32_t second;
+
+    bool operator<(const CandidateRecord &other) const {
+        return tie(first, second) < tie(other.first, other.second);
+    }
+};
+
+/**
+ * @class ExternalScan
+ * @details Parses A Window Of Files At A Time, Writing Each Function's Location And Token Hash Set To A Spill File,
+ * Its Band Keys To An ExternalSorter And Its Metric Report Results To Their Own Files; Duplicates Are Then Found By
+ * Streaming The Sorted Band Keys Into Sorted Candidate Pairs, Each Verified By Reading Back Two Token Sets. Beyond
+ * The Memory Cap, Only The Clone Classes' Union-Find Grows With The Repository, By One Int Per Function
+ */
+class ExternalScan {
+private:
+    // Parses Each Window Of Files, Through The Cache When Enabled
+    RepositoryScanner &scanner;
+    // Private Directory Under The Spill Directory, Removed With Everything In It
+    string workDirectory;
+    // Memory Shared By The Sort Buffers, Also Bounds The Source Parsed At Once
+    size_t memoryCap;
+    // Per Function Records: [SpilledRecordHeader][Name][u64 Token Hashes, Sorted]
+    ofstream functionRecords;
+    // Byte Offset Of Each Function's Record, Then The End Of The Last One
+    ofstream functionOffsets;
+    uint64_t recordsEnd = 0;
+    // Read Side Of The Two Files Above, Opened Once Parsing Is Done
+    int recordsDescriptor = -1;
+    int offsetsDescriptor = -1;
+    // Band Keys Of Every Function
+    unique_ptr<ExternalSorter<BandKeyRecord>> bandKeys = nullptr;
+    // MetricResultRecords Of Each Metric Report, In Function Order
+    array<ofstream, NUM_OF_METRIC_REPORTS> metricResults = {};
+    array<int, NUM_OF_METRIC_REPORTS> numOfMetricResults = {};
+    // Found By The First Duplicates Report
+    vector<vector<int>> cloneClasses = {};
+    bool hasCloneClasses = false;
+    // Total Number of Functions
+    uint32_t numOfFunc = 0;
+    // Set Once A Sort Run Could Not Be Written Or Read Back
+    bool isSpillFailed = false;
+    // Phase Timers And Counters, Null When Disabled
+    AnalysisStatistics *analysisStatistics = nullptr;
+
+    /**
+     * getWorkPath() Path Of A File In The Work Directory
+     *
+     * @param fileName String
+     * @return String
+     */
+    string getWorkPath(const string &fileName) const;
+
+    /**
+     * getWindowEnd() One Past The Last File Of The Window Starting At firstFile, At Least One File
+     *
+     * @param firstFile size_t
+     * @return size_t
+     */
+    size_t getWindowEnd(size_t firstFile) const;
+
+    /**
+     * spillFunctions() Write One Parsed File's Functions, Band Keys And Metric Rows
+     *
+     * @param fileFunctions FunctionExtrapolation, Emptied
+     * @param pathIndex uint32_t, Index Into The Scanner's Source Paths
+     * @return Boolean, False When A Band Key Run Cannot Be Written
+     */
+    bool spillFunctions(FunctionExtrapolation &&fileFunctions, uint32_t pathIndex);
+
+    /**
+     * readFunction() Read A Function's Record Back
+     *
+     * @param function uint32_t
+     * @param spilledFunction SpilledFunction
+     * @return Boolean, False When The Record Cannot Be Read
+     */
+    bool readFunction(uint32_t function, SpilledFunction &spilledFunction) const;
+
+    /**
+     * getReportLocation() Function Name, File And Lines As Reports Show Them
+     *
+     * @param spilledFunction SpilledFunction
+     * @return ReportLocation, Viewing Into spilledFunction
+     */
+    ReportLocation getReportLocation(const SpilledFunction &spilledFunction) const;
+
+    /**
+     * getMetricSlot() Spill File Index Of A Metric Report
+     *
+     * @param reportType ReportType
+     * @return Int, -1 When It Is Not A Metric Report
+     */
+    static int getMetricSlot(ReportType reportType);
+
+    /**
+     * findCloneClasses() Stream Candidate Pairs Out Of The Band Keys And Verify Them In Order
+     *
+     * @param classes vector<vector<int>> Function Indexes, Each Class Sorted, Ordered By Its First Function
+     * @return Boolean, False When A Band Key Or Candidate Run Cannot Be Written Or Read Back
+     */
+    bool findCloneClasses(vector<vector<int>> &classes);
+
+public:
+    /**
+     * ExternalScan() Constructor To Create Instance of ExternalScan, Its Work Directory Made Under spillDirectory
+     *
+     * @param repositoryScanner RepositoryScanner, Its Source Files Already Collected
+     * @param spillDirectory String
+     * @param memoryBytes size_t, Memory For Sorting, Also Bounds The Window Of Parsed Files
+     */
+    ExternalScan(RepositoryScanner &repositoryScanner, const string &spillDirectory, size_t memoryBytes);
+
+    ExternalScan(const ExternalScan &) = delete;
+
+    ExternalScan &operator=(const ExternalScan &) = delete;
+
+    /**
+     * ~ExternalScan() Close And Remove The Work Directory
+     */
+    ~ExternalScan();
+
+    /**
+     * isUsable() Whether The Work Directory And Its Files Could Be Created
+     *
+     * @return Boolean
+     */
+    bool isUsable() const;
+
+    /**
+     * setStatistics() Record The Duplicate Phase And Its Candidates, Null Disables Them
+     *
+     * @param statistics AnalysisStatistics, Owned By The Caller
+     */
+    void setStatistics(AnalysisStatistics *statistics);
+
+    /**
+     * scanFiles() Parse Every Collected File, One Window At A Time, Spilling Each
+     *
+     * @return Boolean, False When A Spill File Or Sort Run Cannot Be Written
+     */
+    bool scanFiles();
+
+    /**
+     * hasSpillFailed() Whether A Sort Run Could Not Be Written Or Read Back, Leaving Results Incomplete
+     *
+     * @return Boolean
+     */
+    bool hasSpillFailed() const;
+
+    /**
+     * getNumOfFunctions() Total Number of Functions
+     *
+     * @return Int
+     */
+    int getNumOfFunctions() const;
+
+    /**
+     * writeReport() Send A Report To A Sink From The Spilled Functions, As FunctionExtrapolation Would
+     *
+     * @param reportType ReportType
+     * @param reportSink ReportSink
+     * @return Boolean, False For Reports Needing Every Function In Memory: Functions And Clone Fragments, Or When
+     * The Duplicates Could Not Be Sorted On Disk (hasSpillFailed())
+     */
+    bool writeReport(ReportType reportType, ReportSink &reportSink);
+};
+
+#endif //EXTERNAL_SCAN_H
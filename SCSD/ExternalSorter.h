@@ -0,0 +1,252 @@
+/**
+ * @file ExternalSorter.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Sorts More Fixed Size Records Than Fit In Memory, As Sorted Runs On Disk Merged Back Together
+ */
+
+#ifndef EXTERNAL_SORTER_H
+#define EXTERNAL_SORTER_H
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+// Most Runs Read At Once, More Are Merged Into Longer Runs First
+const size_t EXTERNAL_MERGE_FAN_IN = 64;
+// Smallest Read Buffer Given To Each Run While Merging
+const size_t EXTERNAL_MIN_RUN_BUFFER = 4096;
+
+/**
+ * @class ExternalSorter
+ * @details Records Are Buffered Until memoryBytes Is Used, Then Sorted And Written As A Run; merge() Streams Every
+ * Record Back In Order With A k-Way Heap Merge, Each Run Read Through Its Own Slice Of The Same Memory
+ */
+template<typename Record>
+class ExternalSorter {
+    static_assert(is_trivially_copyable_v<Record>, "Runs Store Records As Raw Bytes");
+
+private:
+    // Run Files Are Named <runDirectory>/<runName>.<N>.run
+    string runDirectory;
+    string runName;
+    // Records Buffered Before A Run Is Written
+    size_t bufferCapacity;
+    vector<Record> recordBuffer = {};
+    // Run Files Not Yet Merged
+    vector<string> runPaths = {};
+    // Names Runs Uniquely, Merged Runs Included
+    int numOfRuns = 0;
+    // Records Added
+    size_t numOfRecords = 0;
+
+    /**
+     * RunReader Buffered Reader Of One Run, Its Current Record At Front
+     */
+    struct RunReader {
+        ifstream runFile;
+        vector<Record> block;
+        size_t blockIndex = 0;
+
+        /**
+         * advance() Move To The Next Record, Refilling The Block From The File
+         *
+         * @return Boolean, False Once The Run Is Exhausted
+         */
+        bool advance() {
+            if (++blockIndex < block.size()) {
+                return true;
+            }
+            block.resize(block.capacity());
+            runFile.read(reinterpret_cast<char *>(block.data()), streamsize(block.size() * sizeof(Record)));
+            block.resize(size_t(runFile.gcount()) / sizeof(Record));
+            blockIndex = 0;
+            return !block.empty();
+        }
+    };
+
+    /**
+     * getNextRunPath() File Path Of A New Run
+     *
+     * @return String
+     */
+    string getNextRunPath() {
+        return (filesystem::path(runDirectory) / (runName + "." + to_string(numOfRuns++) + ".run")).string();
+    }
+
+    /**
+     * spillBuffer() Sort The Buffer And Write It As A Run
+     *
+     * @return Boolean, False When The Run Cannot Be Written
+     */
+    bool spillBuffer() {
+        if (recordBuffer.empty()) {
+            return true;
+        }
+        sort(recordBuffer.begin(), recordBuffer.end());
+        string runPath = getNextRunPath();
+        ofstream runFile(runPath, ios::binary | ios::trunc);
+        runFile.write(reinterpret_cast<const char *>(recordBuffer.data()),
+                      streamsize(recordBuffer.size() * sizeof(Record)));
+        runPaths.push_back(runPath);
+        recordBuffer.clear();
+        return bool(runFile.flush());
+    }
+
+    /**
+     * mergeRuns() Merge Runs In Order Into A Consumer
+     *
+     * @param paths vector<string>, At Most EXTERNAL_MERGE_FAN_IN Runs
+     * @param consumer function<void(const Record &)>
+     */
+    void mergeRuns(const vector<string> &paths, const function<void(const Record &)> &consumer) const {
+        size_t runBytes = max(EXTERNAL_MIN_RUN_BUFFER,
+                              bufferCapacity * sizeof(Record) / max<size_t>(1, paths.size()));
+        size_t blockRecords = max<size_t>(1, runBytes / sizeof(Record));
+        vector<unique_ptr<RunReader>> readers = {};
+        auto isAfter = [&readers](size_t reader1, size_t reader2) {
+            return readers[reader2]->block[readers[reader2]->blockIndex] <
+                   readers[reader1]->block[readers[reader1]->blockIndex];
+        };
+        priority_queue<size_t, vector<size_t>, decltype(isAfter)> mergeHeap(isAfter);
+        for (const string &runPath: paths) {
+            auto reader = make_unique<RunReader>();
+            reader->runFile.open(runPath, ios::binary);
+            reader->block.reserve(blockRecords);
+            // Starting One Before The First Record Makes advance() Load The First Block
+            reader->blockIndex = size_t(-1);
+            readers.push_back(std::move(reader));
+            if (readers.back()->advance()) {
+                mergeHeap.push(readers.size() - 1);
+            }
+        }
+        while (!mergeHeap.empty()) {
+            size_t smallest = mergeHeap.top();
+            mergeHeap.pop();
+            consumer(readers[smallest]->block[readers[smallest]->blockIndex]);
+            if (readers[smallest]->advance()) {
+                mergeHeap.push(smallest);
+            }
+        }
+    }
+
+public:
+    /**
+     * ExternalSorter() Constructor To Create Instance of ExternalSorter
+     *
+     * @param directory String, Holds The Run Files, Which Must Exist
+     * @param name String, Prefix Of The Run Files
+     * @param memoryBytes size_t, Memory For Buffered Records, Reused By merge() For Reading Runs
+     */
+    ExternalSorter(const string &directory, const string &name, size_t memoryBytes)
+            : runDirectory(directory), runName(name),
+              bufferCapacity(max<size_t>(1, memoryBytes / sizeof(Record))) {
+    }
+
+    ExternalSorter(const ExternalSorter &) = delete;
+
+    ExternalSorter &operator=(const ExternalSorter &) = delete;
+
+    /**
+     * ~ExternalSorter() Remove Every Run File Left
+     */
+    ~ExternalSorter() {
+        error_code removeError;
+        for (const string &runPath: runPaths) {
+            filesystem::remove(runPath, removeError);
+        }
+    }
+
+    /**
+     * add() Add A Record, Writing A Run When The Buffer Is Full
+     *
+     * @param record Record
+     * @return Boolean, False When A Run Cannot Be Written
+     */
+    bool add(const Record &record) {
+        if (recordBuffer.capacity() < bufferCapacity) {
+            recordBuffer.reserve(bufferCapacity);
+        }
+        recordBuffer.push_back(record);
+        numOfRecords += 1;
+        return recordBuffer.size() < bufferCapacity || spillBuffer();
+    }
+
+    /**
+     * merge() Pass Every Record Added, In Sorted Order, To A Consumer; Records Fitting In Memory Never Touch Disk
+     *
+     * @param consumer function<void(const Record &)>
+     * @return Boolean, False When A Run Cannot Be Written, Or Fewer Records Than Were Added Could Be Read Back
+     */
+    bool merge(const function<void(const Record &)> &consumer) {
+        if (runPaths.empty()) {
+            sort(recordBuffer.begin(), recordBuffer.end());
+            for (const Record &record: recordBuffer) {
+                consumer(record);
+            }
+            vector<Record>().swap(recordBuffer);
+            return true;
+        }
+        if (!spillBuffer()) {
+            return false;
+        }
+        // The Buffer's Memory Goes To The Run Readers
+        vector<Record>().swap(recordBuffer);
+
+        error_code removeError;
+        while (runPaths.size() > EXTERNAL_MERGE_FAN_IN) {
+            vector<string> mergedPaths(runPaths.begin(), runPaths.begin() + EXTERNAL_MERGE_FAN_IN);
+            string runPath = getNextRunPath();
+            {
+                ofstream runFile(runPath, ios::binary | ios::trunc);
+                mergeRuns(mergedPaths, [&runFile](const Record &record) {
+                    runFile.write(reinterpret_cast<const char *>(&record), sizeof(Record));
+                });
+                if (!runFile.flush()) {
+                    return false;
+                }
+            }
+            for (const string &mergedPath: mergedPaths) {
+                filesystem::remove(mergedPath, removeError);
+            }
+            runPaths.erase(runPaths.begin(), runPaths.begin() + EXTERNAL_MERGE_FAN_IN);
+            runPaths.push_back(runPath);
+        }
+        size_t numOfMerged = 0;
+        mergeRuns(runPaths, [&consumer, &numOfMerged](const Record &record) {
+            numOfMerged += 1;
+            consumer(record);
+        });
+        return numOfMerged == numOfRecords;
+    }
+
+    /**
+     * getNumOfRecords() Records Added
+     *
+     * @return size_t
+     */
+    size_t getNumOfRecords() const {
+        return numOfRecords;
+    }
+
+    /**
+     * getNumOfRuns() Runs Written To Disk, Merged Runs Included
+     *
+     * @return Int
+     */
+    int getNumOfRuns() const {
+        return numOfRuns;
+    }
+};
+
+#endif //EXTERNAL_SORTER_H
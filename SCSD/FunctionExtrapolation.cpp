@@ -5,34 +5,33 @@
  */
 
 #include "FunctionExtrapolation.h"
+#include "CloneDetector.h"
+#include "MinHashIndex.h"
+#include "SimilarityJoin.h"
 
-bool FunctionExtrapolation::isValidExpression(string &expression, const set<char> &acceptableMarks) {
-    vector<string> paramSplits = getStringSplits(expression, DEF_START_INDEX, expression.size());
+#include <atomic>
+#include <numeric>
+#include <ranges>
+#include <thread>
+#include <unordered_map>
 
-    if (paramSplits.size() < SPLIT_SIZE_TOLERANCE) {
-        return false;
-    }
+// Tokens That Add A Path Through A Function, With &&, || And ?
+const set<string_view> decisionKeywords = {"if", "for", "while", "case", "catch"};
 
-    for (const string &item: paramSplits) {
-        bool hasPunctuation = doesContainPunctuation(item, acceptableMarks);
-        if (hasPunctuation) {
-            return false;
-        }
+bool FunctionExtrapolation::isValidExpression(string_view expression, const set<char> &acceptableMarks) {
+    if (countStringSplits(expression) < SPLIT_SIZE_TOLERANCE) {
+        return false;
     }
-    return true;
+    return !doesContainPunctuation(expression, acceptableMarks);
 }
 
-bool FunctionExtrapolation::isValidFuncParams(string &funcParams, const set<char> &acceptableMarks) {
+bool FunctionExtrapolation::isValidFuncParams(string_view funcParams, const set<char> &acceptableMarks) {
     int numOfRoundBrackets = 0;
-    string variableWord;
+    variableWord.clear();
 
-    int i = 0;
-    while (i < funcParams.size()) {
-        char paramLetter = '\0';
+    for (char paramLetter: funcParams) {
         bool declStatus = true;
 
-        paramLetter = funcParams.at(i);
-
         if (paramLetter == '(') {
             numOfRoundBrackets += 1;
         } else if (paramLetter == ')') {
@@ -40,11 +39,11 @@ bool FunctionExtrapolation::isValidFuncParams(string &funcParams, const set<char
 
             if (!variableWord.empty()) {
                 declStatus = isValidExpression(variableWord, acceptableMarks);
-                variableWord = "";
+                variableWord.clear();
             }
         } else if (paramLetter == ',') {
             declStatus = isValidExpression(variableWord, acceptableMarks);
-            variableWord = "";
+            variableWord.clear();
         } else {
             variableWord += paramLetter;
         }
@@ -52,7 +51,6 @@ bool FunctionExtrapolation::isValidFuncParams(string &funcParams, const set<char
         if (!declStatus) {
             return false;
         }
-        i += 1;
     }
 
     if (numOfRoundBrackets == 2 && variableWord.empty()) {
@@ -61,157 +59,647 @@ bool FunctionExtrapolation::isValidFuncParams(string &funcParams, const set<char
     return false;
 }
 
-bool FunctionExtrapolation::isValidFuncName(string &funcName) {
+bool FunctionExtrapolation::isValidFuncName(string_view funcName) {
     return isValidExpression(funcName);
 }
 
-bool FunctionExtrapolation::extractFuncName(string &funcName, string &lineOfCode) {
-    // Get
-    unsigned int i = DEF_START_INDEX;
-    while (i < lineOfCode.size()) {
-        if (lineOfCode.at(i) == '(') {
-            break;
-        }
-        funcName.push_back(lineOfCode.at(i));
-        i += 1;
+string_view FunctionExtrapolation::extractFuncName(string_view lineOfCode) {
+    string_view funcName = lineOfCode.substr(DEF_START_INDEX, lineOfCode.find('('));
+    string_view strippedName = spaceStripView(funcName);
+    return strippedName.empty() ? funcName : strippedName;
+}
+
+string_view FunctionExtrapolation::extractFuncParams(size_t startIndex, string_view lineOfCode) {
+    if (startIndex >= lineOfCode.size()) {
+        return {};
     }
-    // Verify
-    funcName = spaceStrip(funcName);
-    return isValidFuncName(funcName);
+    string_view funcParams = lineOfCode.substr(startIndex);
+    funcParams = funcParams.substr(DEF_START_INDEX, funcParams.find('{'));
+    string_view strippedParams = spaceStripView(funcParams);
+    return strippedParams.empty() ? funcParams : strippedParams;
 }
 
-bool FunctionExtrapolation::extractFuncParams(unsigned int startIndex, string &funcParams, string &lineOfCode) {
-    set<char> paramsAcceptableMarks = {'=', '&', '*'};
-    // GET
-    unsigned int i = startIndex;
-    while (i < lineOfCode.size()) {
-        if (lineOfCode.at(i) == '{') {
-            break;
+bool FunctionExtrapolation::isDuplicateCode(const FunctionExpression &funcExpress1,
+                                            const FunctionExpression &funcExpress2) {
+
+    double similarIndex = getJaccardSimilarIndex(funcExpress1.tokenSet, funcExpress2.tokenSet);
+
+    if (similarIndex >= JACCARD_INDEX_THRESHOLD) {
+        return true;
+    }
+    return false;
+}
+
+void FunctionExtrapolation::measureNewFunctions() {
+    PhaseTimer metricTimer(analysisStatistics, PHASE_METRIC);
+    vector<string_view> paramsList = {};
+    vector<SourceToken> textTokens = {};
+    for (int i = functionMetrics.getNumOfRows(); i < int(funcExpressions.size()); i++) {
+        const FunctionExpression &funcExpr = funcExpressions[i];
+        MetricsRow metrics = {};
+        paramsList.clear();
+        funcExpr.extrapolateParams(paramsList, sourceArena);
+        metrics[METRIC_PARAMS] = int32_t(paramsList.size());
+        metrics[METRIC_LENGTH] = funcExpr.endLine - funcExpr.stLine;
+
+        span<const SourceToken> funcTokens = getFunctionTokens(funcExpr);
+        if (funcTokens.empty()) {
+            textTokens.clear();
+            SourceLexer::tokenize(funcExpr.funcName, textTokens);
+            SourceLexer::tokenize(funcExpr.funcParams, textTokens);
+            for (string_view bodyLine: funcExpr.funcBody) {
+                SourceLexer::tokenize(bodyLine, textTokens);
+            }
+            funcTokens = textTokens;
         }
-        funcParams.push_back(lineOfCode.at(i));
-        i += 1;
+
+        int depth = 0, maxDepth = 0, numOfDecisions = 0;
+        for (const SourceToken &token: funcTokens) {
+            if (token.kind == TOKEN_COMMENT || token.kind == TOKEN_PREPROCESSOR) {
+                continue;
+            }
+            metrics[METRIC_TOKENS] += 1;
+            string_view text = token.text;
+            if (text == "{") {
+                depth += 1;
+                maxDepth = max(maxDepth, depth);
+            } else if (text == "}") {
+                depth -= 1;
+            } else if (text == "&&" || text == "||" || text == "?" ||
+                       (token.kind == TOKEN_IDENTIFIER && decisionKeywords.contains(text))) {
+                numOfDecisions += 1;
+            }
+        }
+        // The Function's Own Braces Are Not Nesting
+        metrics[METRIC_NESTING] = max(0, maxDepth - 1);
+        metrics[METRIC_CYCLOMATIC] = 1 + numOfDecisions;
+        functionMetrics.appendRow(metrics);
     }
-    funcParams = spaceStrip(funcParams);
-    // Verify
-    return isValidFuncParams(funcParams, paramsAcceptableMarks);
 }
 
-void FunctionExtrapolation::extractFuncBody(unsigned int startIndex, string &funcBody, string &lineOfCode) {
-    // GET
-    unsigned int i = startIndex;
-    while (i < lineOfCode.size()) {
-        funcBody.push_back(lineOfCode.at(i));
-        i += 1;
+ReportLocation FunctionExtrapolation::getReportLocation(const FunctionExpression &funcExpr) const {
+    ReportLocation location = {funcExpr.funcName, {}, {}, funcExpr.stLine, funcExpr.endLine};
+    if (funcExpr.fileIndex >= 0) {
+        location.filePath = sourceFiles.at(funcExpr.fileIndex);
     }
-    spaceStrip(funcBody);
+    return location;
 }
 
-bool FunctionExtrapolation::isDuplicateCode(const FunctionExpression &funcExpress1,
-                                            const FunctionExpression &funcExpress2) {
+void FunctionExtrapolation::mergeFunctions(FunctionExtrapolation &&fileFunctions, const string &filePath) {
+    int fileIndex = int(sourceFiles.size());
+    sourceFiles.push_back(filePath);
 
-    vector<string> funCompose1 = {};
-    vector<string> funCompose2 = {};
+    int tokenOffset = int(sourceTokens.size());
+    if (sourceTokens.empty()) {
+        sourceTokens = std::move(fileFunctions.sourceTokens);
+    } else {
+        sourceTokens.insert(sourceTokens.end(), fileFunctions.sourceTokens.begin(), fileFunctions.sourceTokens.end());
+    }
+    for (MappedSource &fileSource: fileFunctions.ownedSources) {
+        ownedSources.push_back(std::move(fileSource));
+    }
+    // Token Ids Are Local To Each Pool, Interned Sets Are Renamed Into This One Unless It Is Still Empty
+    if (tokenPool.getNumOfTokens() == 0) {
+        tokenPool = std::move(fileFunctions.tokenPool);
+    } else if (fileFunctions.tokenPool.getNumOfTokens() > 0) {
+        vector<uint32_t> tokenIdMap(fileFunctions.tokenPool.getNumOfTokens());
+        for (uint32_t tokenId = 0; tokenId < tokenIdMap.size(); tokenId++) {
+            tokenIdMap[tokenId] = tokenPool.intern(fileFunctions.tokenPool.getToken(tokenId));
+        }
+        vector<uint32_t> tokenIds = {};
+        for (FunctionExpression &funcExpr: fileFunctions.funcExpressions) {
+            tokenIds.clear();
+            for (uint32_t tokenId: funcExpr.tokenSet) {
+                tokenIds.push_back(tokenIdMap[tokenId]);
+            }
+            toTokenSet(tokenIds);
+            funcExpr.tokenSet = sourceArena.storeArray(span<const uint32_t>(tokenIds));
+        }
+    }
 
-    funcExpress1.getExtrapolatedComposition(funCompose1);
-    funcExpress2.getExtrapolatedComposition(funCompose2);
+    functionMetrics.appendTable(fileFunctions.functionMetrics);
+    mergedArenas.push_back(std::move(fileFunctions.sourceArena));
+    for (SourceArena &fileArena: fileFunctions.mergedArenas) {
+        mergedArenas.push_back(std::move(fileArena));
+    }
 
-    double similarIndex = getJaccardSimilarIndex(funCompose1, funCompose2);
+    funcExpressions.reserve(funcExpressions.size() + fileFunctions.funcExpressions.size());
+    for (FunctionExpression &funcExpr: fileFunctions.funcExpressions) {
+        funcExpr.fileIndex = fileIndex;
+        funcExpr.tokenBegin += tokenOffset;
+        funcExpr.tokenEnd += tokenOffset;
+        funcExpressions.push_back(std::move(funcExpr));
+    }
+    numOfFunc = int(funcExpressions.size());
+
+    fileFunctions.funcExpressions.clear();
+    fileFunctions.sourceTokens.clear();
+    fileFunctions.ownedSources.clear();
+    fileFunctions.mergedArenas.clear();
+    fileFunctions.functionMetrics = MetricsTable();
+    fileFunctions.numOfFunc = 0;
+}
 
-    if (similarIndex >= JACCARD_INDEX_THRESHOLD) {
-        return true;
+int FunctionExtrapolation::getNumOfFunctions() const {
+    return numOfFunc;
+}
+
+const vector<FunctionExpression> &FunctionExtrapolation::getFunctions() const {
+    return funcExpressions;
+}
+
+const MetricsTable &FunctionExtrapolation::getMetrics() const {
+    return functionMetrics;
+}
+
+const TokenPool &FunctionExtrapolation::getTokenPool() const {
+    return tokenPool;
+}
+
+span<const SourceToken> FunctionExtrapolation::getFunctionTokens(const FunctionExpression &funcExpr) const {
+    return span<const SourceToken>(sourceTokens).subspan(funcExpr.tokenBegin, funcExpr.tokenEnd - funcExpr.tokenBegin);
+}
+
+void FunctionExtrapolation::assignFunctionTokens(string_view contents) {
+    // Lexing Is Part Of Parsing
+    PhaseTimer parseTimer(analysisStatistics, PHASE_PARSE);
+    int firstToken = int(sourceTokens.size());
+    SourceLexer::tokenize(contents, sourceTokens);
+
+    int numOfTokens = int(sourceTokens.size());
+    int t = firstToken;
+    for (FunctionExpression &funcExpr: funcExpressions) {
+        while (t < numOfTokens && sourceTokens[t].lineNumber < funcExpr.stLine) {
+            t += 1;
+        }
+        funcExpr.tokenBegin = t;
+        while (t < numOfTokens && sourceTokens[t].lineNumber < funcExpr.endLine) {
+            t += 1;
+        }
+        funcExpr.tokenEnd = t;
     }
-    return false;
 }
 
 void FunctionExtrapolation::printFuncExpressions() {
-    cout << "\n--List Of Functions From Source Code:--\n";
-    for (const FunctionExpression &funcExpr: funcExpressions) {
-        cout << "\t" << (funcExpr.funcName + funcExpr.funcParams) << "\n";
+    printReport(REPORT_FUNCTIONS);
+}
+
+void FunctionExtrapolation::setDuplicateEngine(DuplicateEngine engine) {
+    duplicateEngine = engine;
+}
+
+void FunctionExtrapolation::setExactMatchMode(ExactMatchMode mode) {
+    exactMatchMode = mode;
+}
+
+void FunctionExtrapolation::setNumOfThreads(unsigned int threads) {
+    numOfThreads = threads > 0 ? threads : max(1u, thread::hardware_concurrency());
+}
+
+void FunctionExtrapolation::setStatistics(AnalysisStatistics *statistics) {
+    analysisStatistics = statistics;
+}
+
+void FunctionExtrapolation::internFunctionTokens() {
+    vector<string_view> funCompose = {};
+    vector<uint32_t> tokenIds = {};
+    for (FunctionExpression &funcExpr: funcExpressions) {
+        if (!funcExpr.tokenSet.empty()) {
+            continue;
+        }
+        funCompose.clear();
+        tokenIds.clear();
+        funcExpr.getExtrapolatedComposition(funCompose, sourceArena);
+        for (string_view token: funCompose) {
+            tokenIds.push_back(tokenPool.intern(token));
+        }
+        toTokenSet(tokenIds);
+        funcExpr.tokenSet = sourceArena.storeArray(span<const uint32_t>(tokenIds));
     }
 }
 
-void FunctionExtrapolation::printDuplicateFunc() {
-    cout << "\n--Duplicate Functions Results: [INDEX-THRESHOLD " << JACCARD_INDEX_THRESHOLD << "]--\n";
-    bool duplicateExists = false;
-    for (int i = 0; i < funcExpressions.size() - 1; i++) {
-        const FunctionExpression &function1 = funcExpressions.at(i);
-        for (int j = i + 1; j < funcExpressions.size(); j++) {
-            if (i != j) {
-                const FunctionExpression &function2 = funcExpressions.at(j);
-                bool isDuplicate = isDuplicateCode(function1, function2);
-                if (isDuplicate) {
-                    cout << "\t" << function1.funcName << " & " << function2.funcName << " are duplicate\n";
-                    duplicateExists = true;
+void FunctionExtrapolation::runWorkers(const function<void(unsigned int)> &worker) const {
+    if (numOfThreads <= 1) {
+        worker(0);
+        return;
+    }
+    vector<thread> workers = {};
+    for (unsigned int w = 0; w < numOfThreads; w++) {
+        workers.emplace_back(worker, w);
+    }
+    for (thread &workerThread: workers) {
+        workerThread.join();
+    }
+}
+
+vector<pair<int, int>> FunctionExtrapolation::findPairwiseDuplicates(span<const int> engineFunctions,
+                                                                     ConcurrentUnionFind *cloneClasses) {
+    int numOfFunctions = int(engineFunctions.size());
+    atomic<int> nextRow = 0;
+    atomic<int64_t> numOfCompared = 0;
+    vector<vector<pair<int, int>>> workerPairs(numOfThreads);
+    runWorkers([&](unsigned int w) {
+        int64_t compared = 0;
+        for (int i = nextRow++; i + 1 < numOfFunctions; i = nextRow++) {
+            const FunctionExpression &function1 = funcExpressions[engineFunctions[i]];
+            for (int j = i + 1; j < numOfFunctions; j++) {
+                // Already Joined Through Other Matches, Comparing Cannot Change The Class
+                if (cloneClasses != nullptr && cloneClasses->isSameSet(i, j)) {
+                    continue;
+                }
+                compared += 1;
+                if (isDuplicateCode(function1, funcExpressions[engineFunctions[j]])) {
+                    workerPairs[w].emplace_back(engineFunctions[i], engineFunctions[j]);
+                    if (cloneClasses != nullptr) {
+                        cloneClasses->unite(i, j);
+                    }
                 }
             }
         }
+        numOfCompared += compared;
+    });
+
+    vector<pair<int, int>> duplicatePairs = {};
+    for (const vector<pair<int, int>> &pairs: workerPairs) {
+        duplicatePairs.insert(duplicatePairs.end(), pairs.begin(), pairs.end());
     }
-    if (!duplicateExists) {
-        cout << "\tNo Functions are Duplicate\n";
+    sort(duplicatePairs.begin(), duplicatePairs.end());
+    if (analysisStatistics != nullptr) {
+        int64_t numOfPairs = int64_t(numOfFunctions) * (int64_t(numOfFunctions) - 1) / 2;
+        analysisStatistics->addCandidates(numOfPairs, numOfPairs - numOfCompared, numOfCompared);
     }
+    return duplicatePairs;
 }
 
-void FunctionExtrapolation::printLongParams() {
-    cout << "\n--Long Function Parameters Results: [THRESHOLD " << FUN_PARAM_THRESHOLD << "]--\n";
+void FunctionExtrapolation::computeSignatures() {
+    internFunctionTokens();
+    MinHashIndex signatureIndex;
+    vector<uint64_t> signature(signatureIndex.getSignatureSize());
+    vector<uint64_t> tokenHashes = {};
+    for (FunctionExpression &funcExpr: funcExpressions) {
+        if (funcExpr.signature.size() == signature.size()) {
+            continue;
+        }
+        tokenHashes.clear();
+        for (uint32_t tokenId: funcExpr.tokenSet) {
+            tokenHashes.push_back(tokenPool.getTokenHash(tokenId));
+        }
+        signatureIndex.computeSignature(tokenHashes, signature);
+        funcExpr.signature = sourceArena.storeArray(span<const uint64_t>(signature));
+    }
+}
 
-    bool longParamExists = false;
-    for (const FunctionExpression &funcExpr: funcExpressions) {
-        vector<string> paramsList = {};
-        funcExpr.extrapolateParams(paramsList);
+vector<pair<int, int>> FunctionExtrapolation::findMinHashDuplicates(span<const int> engineFunctions,
+                                                                    ConcurrentUnionFind *cloneClasses) {
+    computeSignatures();
+    MinHashIndex signatureIndex;
+    for (int function: engineFunctions) {
+        signatureIndex.addSignature(funcExpressions[function].signature);
+    }
 
-        if (paramsList.size() > FUN_PARAM_THRESHOLD) {
-            cout << "\t" << funcExpr.funcName << "\t---> Num Of Parameters: " << paramsList.size() << "\n";
-            longParamExists = true;
+    vector<pair<int, int>> candidatePairs = signatureIndex.getCandidatePairs();
+    atomic<size_t> nextCandidate = 0;
+    atomic<int64_t> numOfCompared = 0;
+    vector<vector<pair<int, int>>> workerPairs(numOfThreads);
+    runWorkers([&](unsigned int w) {
+        int64_t compared = 0;
+        for (size_t begin = nextCandidate.fetch_add(DUP_VERIFY_CHUNK); begin < candidatePairs.size();
+             begin = nextCandidate.fetch_add(DUP_VERIFY_CHUNK)) {
+            size_t end = min(candidatePairs.size(), begin + DUP_VERIFY_CHUNK);
+            for (size_t c = begin; c < end; c++) {
+                const pair<int, int> &candidate = candidatePairs[c];
+                if (cloneClasses != nullptr && cloneClasses->isSameSet(candidate.first, candidate.second)) {
+                    continue;
+                }
+                compared += 1;
+                int function1 = engineFunctions[candidate.first], function2 = engineFunctions[candidate.second];
+                if (isDuplicateCode(funcExpressions[function1], funcExpressions[function2])) {
+                    workerPairs[w].emplace_back(function1, function2);
+                    if (cloneClasses != nullptr) {
+                        cloneClasses->unite(candidate.first, candidate.second);
+                    }
+                }
+            }
         }
+        numOfCompared += compared;
+    });
+
+    vector<pair<int, int>> duplicatePairs = {};
+    for (const vector<pair<int, int>> &pairs: workerPairs) {
+        duplicatePairs.insert(duplicatePairs.end(), pairs.begin(), pairs.end());
     }
-    if (!longParamExists) {
-        cout << "\tNo Functions With Long Parameters Exists\n";
+    sort(duplicatePairs.begin(), duplicatePairs.end());
+    if (analysisStatistics != nullptr) {
+        analysisStatistics->addCandidates(int64_t(candidatePairs.size()),
+                                          int64_t(candidatePairs.size()) - numOfCompared, numOfCompared);
     }
+    return duplicatePairs;
 }
 
-void FunctionExtrapolation::printLongFunction() {
-    cout << "\n--Long Sized Functions Results: [THRESHOLD " << FUN_SIZE_MAX << "]--\n";
-    bool longFuncExists = false;
-    int funcSize = 0;
-    for (const FunctionExpression &funcExpr: funcExpressions) {
-        funcSize = funcExpr.endLine - funcExpr.stLine;
-        if (funcSize > FUN_SIZE_MAX) {
-            cout << "\t" << funcExpr.funcName << "\t---> Func Length Size: " << funcSize << "\n";
-            longFuncExists = true;
+vector<pair<int, int>> FunctionExtrapolation::findPrefixJoinDuplicates(span<const int> engineFunctions,
+                                                                       ConcurrentUnionFind *cloneClasses) {
+    SimilarityJoin similarityJoin;
+    for (int function: engineFunctions) {
+        similarityJoin.addRecord(funcExpressions[function].tokenSet);
+    }
+    vector<pair<int, int>> similarPairs = similarityJoin.findSimilarPairs(JACCARD_INDEX_THRESHOLD, cloneClasses);
+    // Records Follow engineFunctions, Which Ascends, So The Pairs Stay Sorted
+    for (pair<int, int> &similarPair: similarPairs) {
+        similarPair = {engineFunctions[similarPair.first], engineFunctions[similarPair.second]};
+    }
+    if (analysisStatistics != nullptr) {
+        analysisStatistics->addCandidates(similarityJoin.getNumOfCandidates(),
+                                          similarityJoin.getNumOfCandidates() - similarityJoin.getNumOfVerified(),
+                                          similarityJoin.getNumOfVerified());
+    }
+    return similarPairs;
+}
+
+span<const SourceToken> FunctionExtrapolation::getExactBodyTokens(const FunctionExpression &funcExpr, string &bodyText,
+                                                                  vector<SourceToken> &textTokens) const {
+    span<const SourceToken> funcTokens = getFunctionTokens(funcExpr);
+    if (!funcTokens.empty()) {
+        auto paramsStart = ranges::find_if(funcTokens, [](const SourceToken &token) {
+            return token.text == "(";
+        });
+        return funcTokens.subspan(size_t(paramsStart - funcTokens.begin()));
+    }
+    bodyText.assign(funcExpr.funcParams);
+    for (string_view bodyLine: funcExpr.funcBody) {
+        bodyText.push_back('\n');
+        bodyText.append(bodyLine);
+    }
+    textTokens.clear();
+    SourceLexer::tokenize(bodyText, textTokens);
+    return textTokens;
+}
+
+vector<int> FunctionExtrapolation::groupExactDuplicates(ConcurrentUnionFind &cloneClasses) {
+    int numOfFunctions = int(funcExpressions.size());
+    bool isPlaceholders = exactMatchMode == EXACT_MATCH_PLACEHOLDERS;
+    auto isCodeToken = [](const SourceToken &token) {
+        return token.kind != TOKEN_COMMENT && token.kind != TOKEN_PREPROCESSOR;
+    };
+    // Zero Marks A Function Too Short To Group
+    vector<uint64_t> bodyHashes(numOfFunctions, 0);
+    runWorkers([&](unsigned int worker) {
+        string bodyText = {};
+        vector<SourceToken> textTokens = {};
+        vector<uint64_t> tokenHashes = {};
+        for (int i = int(worker); i < numOfFunctions; i += int(numOfThreads)) {
+            tokenHashes.clear();
+            for (const SourceToken &token: getExactBodyTokens(funcExpressions[i], bodyText, textTokens)) {
+                if (isCodeToken(token)) {
+                    tokenHashes.push_back(isPlaceholders ? CloneDetector::normalizedHash(token)
+                                                         : hashBytes(token.text));
+                }
+            }
+            if (tokenHashes.size() >= EXACT_MATCH_MIN_TOKENS) {
+                string_view bodyBytes(reinterpret_cast<const char *>(tokenHashes.data()),
+                                          tokenHashes.size() * sizeof(uint64_t));
+                bodyHashes[i] = max(hashBytes(bodyBytes), uint64_t(1));
+            }
+        }
+    });
+
+    // A Hash Only Nominates A Group, Its Token Sequence Must Match Too, So Colliding Bodies Stay Apart
+    auto isSameBody = [&](span<const SourceToken> firstTokens, span<const SourceToken> secondTokens) {
+        return ranges::equal(firstTokens | views::filter(isCodeToken), secondTokens | views::filter(isCodeToken),
+                             [isPlaceholders](const SourceToken &a, const SourceToken &b) {
+                                 return isPlaceholders ? CloneDetector::isNormalizedEqual(a, b) : a.text == b.text;
+                             });
+    };
+    // Body Hash -> First Function Of Each Distinct Body With That Hash
+    unordered_map<uint64_t, vector<int>> groupsWithHash = {};
+    // Tokens Of Each First Function Compared So Far, Lexed At Most Once
+    unordered_map<int, span<const SourceToken>> groupTokens = {};
+    unordered_map<int, pair<string, vector<SourceToken>>> groupTexts = {};
+    string bodyText = {};
+    vector<SourceToken> textTokens = {};
+    vector<int> representatives = {};
+    int64_t numOfGrouped = 0;
+    for (int i = 0; i < numOfFunctions; i++) {
+        if (bodyHashes[i] != 0) {
+            vector<int> &hashGroups = groupsWithHash[bodyHashes[i]];
+            span<const SourceToken> bodyTokens = {};
+            if (!hashGroups.empty()) {
+                bodyTokens = getExactBodyTokens(funcExpressions[i], bodyText, textTokens);
+            }
+            auto sameGroup = ranges::find_if(hashGroups, [&](int group) {
+                auto [found, isNew] = groupTokens.try_emplace(group);
+                if (isNew) {
+                    pair<string, vector<SourceToken>> &groupText = groupTexts[group];
+                    found->second = getExactBodyTokens(funcExpressions[group], groupText.first, groupText.second);
+                }
+                return isSameBody(found->second, bodyTokens);
+            });
+            if (sameGroup != hashGroups.end()) {
+                cloneClasses.unite(*sameGroup, i);
+                numOfGrouped += 1;
+                continue;
+            }
+            hashGroups.push_back(i);
+        }
+        representatives.push_back(i);
+    }
+    if (analysisStatistics != nullptr) {
+        analysisStatistics->addExactDuplicates(numOfGrouped);
+    }
+    return representatives;
+}
+
+vector<pair<int, int>> FunctionExtrapolation::runDuplicateEngine(ConcurrentUnionFind *cloneClasses) {
+    PhaseTimer duplicateTimer(analysisStatistics, PHASE_DUPLICATE);
+    internFunctionTokens();
+    if (analysisStatistics != nullptr) {
+        for (const FunctionExpression &funcExpr: funcExpressions) {
+            analysisStatistics->recordTokenSetSize(int64_t(funcExpr.tokenSet.size()));
+        }
+    }
+    auto runEngine = [this](span<const int> engineFunctions, ConcurrentUnionFind *engineClasses) {
+        switch (duplicateEngine) {
+            case DUP_ENGINE_PAIRWISE:
+                return findPairwiseDuplicates(engineFunctions, engineClasses);
+            case DUP_ENGINE_MINHASH:
+                return findMinHashDuplicates(engineFunctions, engineClasses);
+            default:
+                return findPrefixJoinDuplicates(engineFunctions, engineClasses);
         }
+    };
+    if (cloneClasses == nullptr || exactMatchMode == EXACT_MATCH_OFF) {
+        vector<int> engineFunctions(funcExpressions.size());
+        iota(engineFunctions.begin(), engineFunctions.end(), 0);
+        return runEngine(engineFunctions, cloneClasses);
     }
-    if (!longFuncExists) {
-        cout << "\tNo Long Functions Exists \n";
+
+    // The Engine Sees One Function Per Group, Its Classes Indexed Like engineFunctions
+    vector<int> engineFunctions = groupExactDuplicates(*cloneClasses);
+    ConcurrentUnionFind engineClasses(int(engineFunctions.size()));
+    vector<pair<int, int>> duplicatePairs = runEngine(engineFunctions, &engineClasses);
+    for (const pair<int, int> &duplicatePair: duplicatePairs) {
+        cloneClasses->unite(duplicatePair.first, duplicatePair.second);
     }
+    return duplicatePairs;
+}
+
+vector<pair<int, int>> FunctionExtrapolation::findDuplicatePairs() {
+    return runDuplicateEngine(nullptr);
+}
+
+vector<vector<int>> FunctionExtrapolation::findCloneClasses() {
+    ConcurrentUnionFind cloneClasses(int(funcExpressions.size()));
+    runDuplicateEngine(&cloneClasses);
+    return cloneClasses.getClasses();
+}
+
+void FunctionExtrapolation::printDuplicateFunc() {
+    printReport(REPORT_DUPLICATES);
+}
+
+void FunctionExtrapolation::printCloneFragments() {
+    printReport(REPORT_CLONE_FRAGMENTS);
+}
+
+vector<int> FunctionExtrapolation::findMetricRows(ReportType reportType) const {
+    if (reportType == REPORT_LONG_FUNCS) {
+        return functionMetrics.findRowsAbove(METRIC_LENGTH, FUN_SIZE_MAX);
+    }
+    if (reportType == REPORT_LONG_PARAMS) {
+        return functionMetrics.findRowsAbove(METRIC_PARAMS, FUN_PARAM_THRESHOLD);
+    }
+    vector<int> complexRows = functionMetrics.findRowsAbove(METRIC_CYCLOMATIC, FUN_COMPLEXITY_MAX);
+    vector<int> nestedRows = functionMetrics.findRowsAbove(METRIC_NESTING, FUN_NESTING_MAX);
+    vector<int> flaggedRows = {};
+    set_union(complexRows.begin(), complexRows.end(), nestedRows.begin(), nestedRows.end(),
+              back_inserter(flaggedRows));
+    return flaggedRows;
+}
+
+int FunctionExtrapolation::writeCloneFragments(ReportSink &reportSink) const {
+    CloneDetector cloneDetector;
+    for (const FunctionExpression &funcExpr: funcExpressions) {
+        cloneDetector.addFunction(getFunctionTokens(funcExpr));
+    }
+
+    auto getRegion = [this, &cloneDetector](int function, int tokenBegin, int numOfTokens) {
+        ReportLocation region = getReportLocation(funcExpressions.at(function));
+        region.startLine = cloneDetector.getTokenLine(tokenBegin);
+        region.endLine = cloneDetector.getTokenLine(tokenBegin + numOfTokens - 1);
+        return region;
+    };
+
+    vector<CloneRegion> clones = cloneDetector.findClones();
+    for (const CloneRegion &clone: clones) {
+        reportSink.addCloneFragment(getRegion(clone.function1, clone.tokenBegin1, clone.numOfTokens),
+                                    getRegion(clone.function2, clone.tokenBegin2, clone.numOfTokens),
+                                    clone.numOfTokens);
+    }
+    return int(clones.size());
+}
+
+void FunctionExtrapolation::writeReport(ReportType reportType, ReportSink &reportSink) {
+    reportSink.beginReport(reportType);
+    int numOfResults = 0;
+    if (reportType == REPORT_FUNCTIONS) {
+        for (const FunctionExpression &funcExpr: funcExpressions) {
+            ReportLocation function = getReportLocation(funcExpr);
+            function.funcParams = funcExpr.funcParams;
+            reportSink.addFunction(function);
+        }
+        numOfResults = numOfFunc;
+    } else if (reportType == REPORT_DUPLICATES) {
+        vector<vector<int>> cloneClasses = findCloneClasses();
+        vector<ReportLocation> members = {};
+        for (size_t c = 0; c < cloneClasses.size(); c++) {
+            members.clear();
+            for (int member: cloneClasses[c]) {
+                members.push_back(getReportLocation(funcExpressions.at(member)));
+            }
+            reportSink.addCloneClass(int(c) + 1, members);
+        }
+        numOfResults = int(cloneClasses.size());
+    } else if (reportType == REPORT_CLONE_FRAGMENTS) {
+        numOfResults = writeCloneFragments(reportSink);
+    } else {
+        vector<int> flaggedRows = findMetricRows(reportType);
+        for (int row: flaggedRows) {
+            reportSink.addMetricResult(reportType, getReportLocation(funcExpressions.at(row)),
+                                       functionMetrics.getRow(row));
+        }
+        numOfResults = int(flaggedRows.size());
+    }
+    reportSink.endReport(reportType, numOfResults);
+}
+
+void FunctionExtrapolation::printReport(ReportType reportType) {
+    BufferedWriter consoleWriter(stdout);
+    ConsoleSink consoleSink(consoleWriter);
+    writeReport(reportType, consoleSink);
+    consoleSink.finish();
+}
+
+void FunctionExtrapolation::printComplexFunctions() {
+    printReport(REPORT_COMPLEX_FUNCS);
+}
+
+void FunctionExtrapolation::printLongParams() {
+    printReport(REPORT_LONG_PARAMS);
+}
+
+void FunctionExtrapolation::printLongFunction() {
+    printReport(REPORT_LONG_FUNCS);
 }
 
 void FunctionExtrapolation::formulateFuncExpressions(const vector<string> &sourceCodeList) {
-    int numOfLoc = 0;
+    vector<SourceLine> sourceLines = {};
+    sourceLines.reserve(sourceCodeList.size());
+    for (const string &loc: sourceCodeList) {
+        sourceLines.push_back({sourceArena.store(loc), int(sourceLines.size()) + 1});
+    }
+    parseSourceLines(sourceLines);
+    measureNewFunctions();
+}
 
-    unsigned int startIndex = DEF_START_INDEX;
-    bool nameExtractRes = false, paramExtractRes = false;
-    string funcName, funcParams, funcBody;
+void FunctionExtrapolation::formulateFuncExpressions(const vector<SourceLine> &sourceLines) {
+    vector<SourceLine> ownedLines = sourceLines;
+    for (SourceLine &ownedLine: ownedLines) {
+        ownedLine.text = sourceArena.store(ownedLine.text);
+    }
+    parseSourceLines(ownedLines);
+    measureNewFunctions();
+}
 
-    for (string loc: sourceCodeList) {
-        numOfLoc += 1;
+void FunctionExtrapolation::parseLineRange(span<const SourceLine> sourceLines, vector<string_view> &leadingLines) {
+    int numOfLoc = 0;
+    int firstNewFunc = numOfFunc;
+    set<char> paramsAcceptableMarks = {'=', '&', '*'};
+    // Body Lines Of The Function Being Read, Copied Into The Arena Once The Function Ends
+    vector<string_view> bodyLines = {};
 
-        startIndex = DEF_START_INDEX;
-        nameExtractRes = false, paramExtractRes = false;
-        funcName = "", funcParams = "", funcBody = "";
+    auto sealFuncBody = [&]() {
+        if (numOfFunc > firstNewFunc) {
+            funcExpressions.at((numOfFunc - 1)).funcBody = sourceArena.storeArray(span<const string_view>(bodyLines));
+        }
+        bodyLines.clear();
+    };
+
+    for (const SourceLine &sourceLine: sourceLines) {
+        numOfLoc = sourceLine.lineNumber;
+        string_view loc = sourceLine.text;
 
-        nameExtractRes = extractFuncName(funcName, loc);
+        string_view funcName = extractFuncName(loc);
+        string_view funcParams = {};
+        bool nameExtractRes = isValidFuncName(funcName), paramExtractRes = false;
         if (nameExtractRes) {
-            startIndex = funcName.size();
-            paramExtractRes = extractFuncParams(startIndex, funcParams, loc);
+            funcParams = extractFuncParams(funcName.size(), loc);
+            paramExtractRes = isValidFuncParams(funcParams, paramsAcceptableMarks);
         }
-        startIndex = funcName.size() + funcParams.size();
+        size_t startIndex = min(funcName.size() + funcParams.size(), loc.size());
 
         if (nameExtractRes && paramExtractRes) {
-            extractFuncBody(startIndex, funcBody, loc);
-
-            FunctionExpression newFunc(funcName, funcParams, funcBody, numOfLoc);
-
-            funcExpressions.push_back(newFunc);
+            sealFuncBody();
+            funcExpressions.emplace_back(funcName, funcParams, numOfLoc);
+            bodyLines.push_back(loc.substr(startIndex));
 
             if (numOfFunc > 0) {
                 funcExpressions.at((numOfFunc - 1)).endLine = numOfLoc;
@@ -219,18 +707,139 @@ void FunctionExtrapolation::formulateFuncExpressions(const vector<string> &sourc
 
             numOfFunc += 1;
         } else {
-            funcBody = funcName + funcParams;
-            extractFuncBody(startIndex, funcBody, loc);
-            if (numOfFunc > 0) {
-                funcExpressions.at((numOfFunc - 1)).funcBody.push_back(funcBody);
+            // The Line Rebuilt From Its Name And Parameter Parts, Usually The Line Itself
+            string_view rest = loc.substr(startIndex);
+            bool isWholeLine = loc.starts_with(funcName) && loc.substr(funcName.size()).starts_with(funcParams) &&
+                               funcName.size() + funcParams.size() == startIndex;
+            string_view bodyLine = isWholeLine ? loc : sourceArena.concat(funcName, funcParams, rest);
+            (numOfFunc > firstNewFunc ? bodyLines : leadingLines).push_back(bodyLine);
+        }
+    }
+    sealFuncBody();
+}
+
+vector<size_t> FunctionExtrapolation::findParseChunks(const vector<SourceLine> &sourceLines) const {
+    size_t numOfChunks = min(size_t(numOfThreads), sourceLines.size() / PARSE_CHUNK_MIN_LINES);
+    if (numOfChunks <= 1) {
+        return {0};
+    }
+    // Braces In Strings And Comments Are Counted Too, A Poor Cut Only Moves Lines Across The Seam
+    auto getBraceChange = [](string_view text) {
+        int braceChange = 0;
+        for (char letter: text) {
+            braceChange += int(letter == '{') - int(letter == '}');
+        }
+        return braceChange;
+    };
+
+    // Brace Depth At Each Even Cut, Summed Chunk By Chunk On The Workers
+    vector<size_t> evenCuts = {};
+    for (size_t c = 0; c <= numOfChunks; c++) {
+        evenCuts.push_back(c * sourceLines.size() / numOfChunks);
+    }
+    vector<int64_t> cutDepths(numOfChunks + 1, 0);
+    runWorkers([&](unsigned int worker) {
+        for (size_t c = worker; c < numOfChunks; c += numOfThreads) {
+            for (size_t l = evenCuts[c]; l < evenCuts[c + 1]; l++) {
+                cutDepths[c + 1] += getBraceChange(sourceLines[l].text);
+            }
+        }
+    });
+    for (size_t c = 1; c <= numOfChunks; c++) {
+        cutDepths[c] += cutDepths[c - 1];
+    }
+
+    // Each Cut Moves Forward To The Line After The Braces Close, Dropped When None Does Before The Next Cut
+    vector<size_t> chunkStarts = {0};
+    for (size_t c = 1; c < numOfChunks; c++) {
+        int64_t depth = cutDepths[c];
+        for (size_t l = evenCuts[c]; l < evenCuts[c + 1]; l++) {
+            if (depth <= 0 && l > chunkStarts.back()) {
+                chunkStarts.push_back(l);
+                break;
             }
+            depth += getBraceChange(sourceLines[l].text);
         }
     }
-    funcExpressions.at((numOfFunc - 1)).endLine = numOfLoc + 1;
+    return chunkStarts;
 }
 
+void FunctionExtrapolation::parseSourceLines(const vector<SourceLine> &sourceLines) {
+    PhaseTimer parseTimer(analysisStatistics, PHASE_PARSE);
+    int firstNewFunc = numOfFunc;
+    vector<size_t> chunkStarts = findParseChunks(sourceLines);
+    if (chunkStarts.size() == 1) {
+        vector<string_view> leadingLines = {};
+        parseLineRange(sourceLines, leadingLines);
+    } else {
+        // Every Chunk Is Parsed Into Its Own Index, Its Own Arena And Scratch, As If It Were A File
+        size_t numOfChunks = chunkStarts.size();
+        chunkStarts.push_back(sourceLines.size());
+        vector<FunctionExtrapolation> chunkIndexes(numOfChunks);
+        vector<vector<string_view>> leadingLines(numOfChunks);
+        runWorkers([&](unsigned int worker) {
+            for (size_t c = worker; c < numOfChunks; c += numOfThreads) {
+                span<const SourceLine> chunkLines(sourceLines.begin() + ptrdiff_t(chunkStarts[c]),
+                                                  sourceLines.begin() + ptrdiff_t(chunkStarts[c + 1]));
+                chunkIndexes[c].parseLineRange(chunkLines, leadingLines[c]);
+            }
+        });
+
+        // Seams: Lines Ahead Of A Chunk's First Function Belong To The Function Open Before It, Which Ends Where
+        // The Next Function Starts
+        vector<string_view> bodyLines = {};
+        for (size_t c = 0; c < numOfChunks; c++) {
+            FunctionExtrapolation &chunkIndex = chunkIndexes[c];
+            if (numOfFunc > firstNewFunc && !leadingLines[c].empty()) {
+                FunctionExpression &openFunc = funcExpressions.back();
+                bodyLines.assign(openFunc.funcBody.begin(), openFunc.funcBody.end());
+                bodyLines.insert(bodyLines.end(), leadingLines[c].begin(), leadingLines[c].end());
+                openFunc.funcBody = sourceArena.storeArray(span<const string_view>(bodyLines));
+            }
+            if (numOfFunc > 0 && !chunkIndex.funcExpressions.empty()) {
+                funcExpressions.back().endLine = chunkIndex.funcExpressions.front().stLine;
+            }
+            funcExpressions.insert(funcExpressions.end(), chunkIndex.funcExpressions.begin(),
+                                   chunkIndex.funcExpressions.end());
+            numOfFunc = int(funcExpressions.size());
+            mergedArenas.push_back(std::move(chunkIndex.sourceArena));
+        }
+    }
+    if (numOfFunc > 0) {
+        funcExpressions.at((numOfFunc - 1)).endLine = (sourceLines.empty() ? 0 : sourceLines.back().lineNumber) + 1;
+    }
+    if (analysisStatistics != nullptr) {
+        analysisStatistics->addParsed(int64_t(sourceLines.size()), numOfFunc - firstNewFunc);
+    }
+}
 
 FunctionExtrapolation::FunctionExtrapolation(const vector<string> &sourceCode) {
     formulateFuncExpressions(sourceCode);
     printFuncExpressions();
-}
\ No newline at end of file
+}
+
+FunctionExtrapolation::FunctionExtrapolation(const vector<SourceLine> &sourceLines, bool displayFunctions) {
+    formulateFuncExpressions(sourceLines);
+    if (displayFunctions) {
+        printFuncExpressions();
+    }
+}
+
+void FunctionExtrapolation::attachSource(MappedSource &&fileSource) {
+    ownedSources.push_back(std::move(fileSource));
+    assignFunctionTokens(ownedSources.back().getContents());
+}
+
+FunctionExtrapolation::FunctionExtrapolation(MappedSource &&fileSource, bool displayFunctions,
+                                             AnalysisStatistics *statistics, unsigned int threads)
+        : analysisStatistics(statistics) {
+    setNumOfThreads(threads);
+    ownedSources.push_back(std::move(fileSource));
+    parseSourceLines(ownedSources.back().getLines());
+    assignFunctionTokens(ownedSources.back().getContents());
+    measureNewFunctions();
+    ownedSources.back().releaseLines();
+    if (displayFunctions) {
+        printFuncExpressions();
+    }
+}
@@ -10,72 +10,126 @@
 #include <iostream>
 #include <vector>
 #include <set>
+#include <span>
 #include <algorithm>
+#include <functional>
+#include <utility>
+#include "AnalysisStatistics.h"
+#include "ConcurrentUnionFind.h"
+#include "FunctionMetrics.h"
+#include "ReportSink.h"
 #include "SharedTransformation.h"
+#include "SourceArena.h"
+#include "SourceLexer.h"
+#include "SourceReader.h"
+#include "TokenPool.h"
 
 using namespace std;
 
 const unsigned short int SPLIT_SIZE_TOLERANCE = 2;
 const unsigned short int FUN_PARAM_THRESHOLD = 3;
 const unsigned short int FUN_SIZE_MAX = 15;
+const unsigned short int FUN_COMPLEXITY_MAX = 10;
+const unsigned short int FUN_NESTING_MAX = 4;
 const double JACCARD_INDEX_THRESHOLD = 0.75;
+// Candidate Pairs A Worker Claims At Once
+const size_t DUP_VERIFY_CHUNK = 4096;
+// Fewest Lines Parsed By One Worker, Smaller Files Are Parsed On The Calling Thread
+const size_t PARSE_CHUNK_MIN_LINES = 50000;
+// Fewest Body Tokens A Function Needs To Be Grouped By Its Hash, Shorter Bodies Match By Accident
+const size_t EXACT_MATCH_MIN_TOKENS = 16;
+
+/**
+ * @enum DuplicateEngine
+ * @details How printDuplicateFunc() Finds Pairs: Every Pair Compared, An Exact Prefix Filtered Join, Or
+ * MinHash/LSH Candidates Verified (Approximate, May Miss Pairs)
+ */
+enum DuplicateEngine {
+    DUP_ENGINE_PAIRWISE, DUP_ENGINE_PREFIX_JOIN, DUP_ENGINE_MINHASH
+};
+
+/**
+ * @enum ExactMatchMode
+ * @details Pre-Pass Of findCloneClasses(): Functions Whose Parameters And Body Lex To The Same Tokens, Whitespace
+ * Aside, Or Also With Identifiers And Literals As Placeholders, Are One Class Found By Hash; Only The First Of
+ * Each Goes On To The Duplicate Engine
+ */
+enum ExactMatchMode {
+    EXACT_MATCH_OFF, EXACT_MATCH_WHITESPACE, EXACT_MATCH_PLACEHOLDERS
+};
 
 /**
  * @struct FunctionExpression
- * @details A Function/Method Structure Decomposition
+ * @details A Function/Method Structure Decomposition, Its Text Viewing Into The Source Or Its Owner's Arena
  */
 struct FunctionExpression {
-    string funcName;
-    string funcParams;
-    vector<string> funcBody;
+    string_view funcName;
+    string_view funcParams;
+    span<const string_view> funcBody;
     int stLine = 0;
     int endLine = 0;
+    int fileIndex = -1;
+    // Interned Name, Parameter And Body Tokens, Sorted Without Repeats, Empty Until Interned
+    span<const uint32_t> tokenSet;
+    // MinHash Signature Of tokenSet, Empty Until Computed
+    span<const uint64_t> signature;
+    // Lexical Tokens [tokenBegin, tokenEnd) Of The Owning FunctionExtrapolation
+    int tokenBegin = 0;
+    int tokenEnd = 0;
 
     /**
-     * FunctionExpression() Constructor To Create FunctionExpression Instance
+     * FunctionExpression() Constructor To Create FunctionExpression Instance, The Body Is Attached Once Parsed
      *
-     * @param name String
-     * @param params String
-     * @param body String
+     * @param name string_view
+     * @param params string_view
      * @param start Int
      */
-    FunctionExpression(const string &name, const string &params, const string &body, int start) {
+    FunctionExpression(string_view name, string_view params, int start) {
         this->funcName = name;
         this->funcParams = params;
-        this->funcBody.push_back(body);
         this->stLine = start;
     }
 
     /**
      * getExtrapolatedComposition() Convert FunctionExpression Decomposition To a Vector
      *
-     * @param funCompose vector<string>
+     * @param funCompose vector<string_view>
+     * @param arena SourceArena, Holds Any Parameter That Is Not A Contiguous Piece Of funcParams
      */
-    void getExtrapolatedComposition(vector<string> &funCompose) const {
+    void getExtrapolatedComposition(vector<string_view> &funCompose, SourceArena &arena) const {
         funCompose.push_back(funcName);
-        extrapolateParams(funCompose);
-        copy(funcBody.begin(), funcBody.end(), back_inserter(funCompose));
+        extrapolateParams(funCompose, arena);
+        funCompose.insert(funCompose.end(), funcBody.begin(), funcBody.end());
     }
 
     /**
      * extrapolateParams() Fetch parameters from strings representation to vector.
      *
-     * @param paramsCompo vector<string>
+     * @param paramsCompo vector<string_view>
+     * @param arena SourceArena, Holds Any Parameter With A Round Bracket Dropped From Its Middle
      */
-    void extrapolateParams(vector<string> &paramsCompo) const {
-        string param;
-        char cParam;
-        for (int i = DEF_START_INDEX; i < funcParams.size(); i++) {
-
-            cParam = funcParams.at(i);
+    void extrapolateParams(vector<string_view> &paramsCompo, SourceArena &arena) const {
+        size_t paramStart = 0;
+        bool inParam = false, splitParam = false;
+        for (size_t i = DEF_START_INDEX; i < funcParams.size(); i++) {
+            char cParam = funcParams[i];
 
             if (cParam == '(') {
-                continue;
-            } else if ((cParam == ',' || cParam == ')') && !param.empty()) {
-                paramsCompo.push_back(spaceStrip(param));
-                param = "";
-            } else {
-                param += cParam;
+                splitParam = splitParam || inParam;
+            } else if ((cParam == ',' || cParam == ')') && inParam) {
+                string_view param = funcParams.substr(paramStart, i - paramStart);
+                if (splitParam) {
+                    string joined;
+                    remove_copy(param.begin(), param.end(), back_inserter(joined), '(');
+                    param = arena.store(joined);
+                }
+                // All-Space Parameters Stay As Written
+                string_view strippedParam = spaceStripView(param);
+                paramsCompo.push_back(strippedParam.empty() ? param : strippedParam);
+                inParam = false, splitParam = false;
+            } else if (!inParam) {
+                inParam = true;
+                paramStart = i;
             }
         }
     }
@@ -86,66 +140,122 @@ struct FunctionExpression {
  * @details Analyze Source Lines Of Code, Extract Functions abstractions And Print Code Smells
  */
 class FunctionExtrapolation {
+    // Reads And Writes The Functions Of One File As A Cache Entry
+    friend class AnalysisCache;
+    // Writes Every Function As A Persisted Index
+    friend class IndexArchive;
+
 private:
     // FunctionExpression Holder
     vector<FunctionExpression> funcExpressions = {};
     // Total Number of Functions
     int numOfFunc = 0;
+    // Source File Paths, Indexed By FunctionExpression fileIndex
+    vector<string> sourceFiles = {};
+    // Duplicate Detection Strategy
+    DuplicateEngine duplicateEngine = DUP_ENGINE_PREFIX_JOIN;
+    // Exact Duplicate Pre-Pass Of findCloneClasses()
+    ExactMatchMode exactMatchMode = EXACT_MATCH_OFF;
+    // Interned Tokens Of Every Function
+    TokenPool tokenPool;
+    // Mapped Files Backing Function Text And sourceTokens
+    vector<MappedSource> ownedSources = {};
+    // Lexical Token Stream Of Every Source, Each Function Owns A Contiguous Range
+    vector<SourceToken> sourceTokens = {};
+    // Derived Text And Arrays Of The Functions Parsed Here
+    SourceArena sourceArena;
+    // Arenas Of Merged Files And Of Chunks Parsed In Parallel
+    vector<SourceArena> mergedArenas = {};
+    // Metrics Of Every Function, Row i Measures funcExpressions[i]
+    MetricsTable functionMetrics;
+    // Parameter Word Scratch, Reused Across Lines
+    string variableWord;
+    // Phase Timers And Counters, Null When Disabled
+    AnalysisStatistics *analysisStatistics = nullptr;
+    // Workers Parsing A Large File And Verifying Duplicate Candidates
+    unsigned int numOfThreads = 1;
+
+    /**
+     * assignFunctionTokens() Lex A Source Once And Give Each Function The Tokens Of Its Lines
+     *
+     * @param contents string_view
+     */
+    void assignFunctionTokens(string_view contents);
+
+    /**
+     * measureNewFunctions() Measure Every Function Not Yet In functionMetrics, From Its Lexical Tokens, Or From
+     * Its Own Text When It Has None
+     */
+    void measureNewFunctions();
 
     /**
      * isValidExpression() Validate expression definition.
      *
-     * @param expression String
+     * @param expression string_view
      * @param acceptableMarks set<char>
      * @return Boolean
      */
-    bool isValidExpression(string &expression, const set<char> &acceptableMarks = {});
+    bool isValidExpression(string_view expression, const set<char> &acceptableMarks = {});
 
     /**
      * isValidFuncParams Validate function parameter definition.
      *
-     * @param funcParams String
+     * @param funcParams string_view
      * @param acceptableMarks set<char>
      * @return Boolean
      */
-    bool isValidFuncParams(string &funcParams, const set<char> &acceptableMarks = {});
+    bool isValidFuncParams(string_view funcParams, const set<char> &acceptableMarks = {});
 
     /**
      * isValidFuncName() Validate function Name definition.
      *
-     * @param funcName String
+     * @param funcName string_view
      * @return Boolean
      */
-    bool isValidFuncName(string &funcName);
+    bool isValidFuncName(string_view funcName);
 
     /**
      * extractFuncName() Extracts a Function Name from a Line of Code
      *
-     * @param funcName String
-     * @param lineOfCode String
-     * @return Boolean
+     * @param lineOfCode string_view
+     * @return string_view, Text Before The First Round Bracket, Stripped
      */
-    bool extractFuncName(string &funcName, string &lineOfCode);
+    static string_view extractFuncName(string_view lineOfCode);
 
     /**
      * extractFuncParams() Extracts Functions Parameters From Line of Code
      *
-     * @param startIndex Int
-     * @param funcParams String
-     * @param lineOfCode String
-     * @return Boolean
+     * @param startIndex size_t
+     * @param lineOfCode string_view
+     * @return string_view, Text From startIndex Up To The First Curly Bracket, Stripped
      */
-    bool extractFuncParams(unsigned int startIndex, string &funcParams, string &lineOfCode);
+    static string_view extractFuncParams(size_t startIndex, string_view lineOfCode);
 
     /**
-     * extractFuncBody() Extract Function Body from Line of Code
+     * parseSourceLines() Formulate FunctionExpressions Viewing Into The Lines' Text, Which Must Outlive Them. A
+     * Large File Is Cut Into Chunks Parsed On numOfThreads Workers, Then Stitched Into The Sequential Result
      *
-     * @param startIndex Int
-     * @param funcBody String
-     * @param lineOfCode String
+     * @param sourceLines vector<SourceLine>
      */
-    void extractFuncBody(unsigned int startIndex, string &funcBody, string &lineOfCode);
-    
+    void parseSourceLines(const vector<SourceLine> &sourceLines);
+
+    /**
+     * parseLineRange() Formulate FunctionExpressions From A Run Of Lines, Each Function Ending Where The Next
+     * Starts; The Last One Is Left Open, Its endLine Set By The Caller
+     *
+     * @param sourceLines span<const SourceLine>
+     * @param leadingLines vector<string_view>, Body Lines Ahead Of The First Function Started Here
+     */
+    void parseLineRange(span<const SourceLine> sourceLines, vector<string_view> &leadingLines);
+
+    /**
+     * findParseChunks() First Line Of Each Chunk Of A Parallel Parse, Each After A Line Closing Every Brace
+     *
+     * @param sourceLines vector<SourceLine>
+     * @return vector<size_t>, Starting With 0, Just {0} When The File Is Parsed In One Piece
+     */
+    vector<size_t> findParseChunks(const vector<SourceLine> &sourceLines) const;
+
     /**
      * isDuplicateCode() Validates If Two FunctionExpressions Are Similar
      *
@@ -155,7 +265,89 @@ private:
      */
     bool isDuplicateCode(const FunctionExpression &funcExpress1, const FunctionExpression &funcExpress2);
 
+    /**
+     * getReportLocation() Function Name, File And Lines As Reports Show Them
+     *
+     * @param funcExpr FunctionExpression
+     * @return ReportLocation, Viewing Into This Index
+     */
+    ReportLocation getReportLocation(const FunctionExpression &funcExpr) const;
+
+    /**
+     * writeCloneFragments() Report Copied Regions Of Code Within And Between Functions
+     *
+     * @param reportSink ReportSink
+     * @return Int Number of Fragments Reported
+     */
+    int writeCloneFragments(ReportSink &reportSink) const;
+
+    /**
+     * printReport() Write A Report To The Console
+     *
+     * @param reportType ReportType
+     */
+    void printReport(ReportType reportType);
+
+    /**
+     * runWorkers() Run A Worker On numOfThreads Threads, Inline When There Is Only One
+     *
+     * @param worker function<void(unsigned int)>, Given Its Worker Index
+     */
+    void runWorkers(const function<void(unsigned int)> &worker) const;
+
+    /**
+     * findPairwiseDuplicates() Compare Every Pair Of Functions
+     *
+     * @param engineFunctions span<const int>, Function Indexes Compared, Ascending
+     * @param cloneClasses ConcurrentUnionFind, Indexed Like engineFunctions, When Not Null Pairs Already In One
+     * Class Are Skipped And Found Pairs United
+     * @return vector<pair<int, int>> Function Indexes
+     */
+    vector<pair<int, int>> findPairwiseDuplicates(span<const int> engineFunctions, ConcurrentUnionFind *cloneClasses);
+
+    /**
+     * findMinHashDuplicates() Verify Only The Pairs Sharing An LSH Band Of Their MinHash Signatures
+     *
+     * @param engineFunctions span<const int>, Function Indexes Compared, Ascending
+     * @param cloneClasses ConcurrentUnionFind, Indexed Like engineFunctions, When Not Null Pairs Already In One
+     * Class Are Skipped And Found Pairs United
+     * @return vector<pair<int, int>> Function Indexes
+     */
+    vector<pair<int, int>> findMinHashDuplicates(span<const int> engineFunctions, ConcurrentUnionFind *cloneClasses);
+
+    /**
+     * findPrefixJoinDuplicates() Exact Similarity Join, Same Pairs As findPairwiseDuplicates()
+     *
+     * @param engineFunctions span<const int>, Function Indexes Compared, Ascending
+     * @param cloneClasses ConcurrentUnionFind, Indexed Like engineFunctions, When Not Null Pairs Already In One
+     * Class Are Skipped And Found Pairs United
+     * @return vector<pair<int, int>> Function Indexes
+     */
+    vector<pair<int, int>> findPrefixJoinDuplicates(span<const int> engineFunctions, ConcurrentUnionFind *cloneClasses);
+
+    /**
+     * groupExactDuplicates() Unite Functions With The Same Body Hash, Under The Exact Match Mode
+     *
+     * @param cloneClasses ConcurrentUnionFind
+     * @return vector<int> First Function Of Each Group And Every Function Too Short To Group, Ascending
+     */
+    vector<int> groupExactDuplicates(ConcurrentUnionFind &cloneClasses);
+
+    /**
+     * runDuplicateEngine() Intern Token Sets And Run The Chosen Engine, After The Exact Match Pre-Pass When Building
+     * Clone Classes
+     *
+     * @param cloneClasses ConcurrentUnionFind, Null For Every Pair
+     * @return vector<pair<int, int>>, Without The Pairs The Pre-Pass Grouped
+     */
+    vector<pair<int, int>> runDuplicateEngine(ConcurrentUnionFind *cloneClasses);
+
 public:
+    /**
+     * FunctionExtrapolation() Constructor To Create An Empty Instance, Filled Through mergeFunctions()
+     */
+    FunctionExtrapolation() = default;
+
     /**
      * FunctionExtrapolation() Constructor To Create Instance of FunctionExtrapolation
      *
@@ -164,22 +356,190 @@ public:
     explicit FunctionExtrapolation(const vector<string> &sourceCode);
 
     /**
-     * formulateFuncExpressions() Formulate the FunctionExpression Abstraction List
+     * FunctionExtrapolation() Constructor To Create Instance of FunctionExtrapolation From Numbered Source Lines
+     *
+     * @param sourceLines vector<SourceLine>
+     * @param displayFunctions Boolean, Print The Functions Found
+     */
+    explicit FunctionExtrapolation(const vector<SourceLine> &sourceLines, bool displayFunctions = true);
+
+    /**
+     * FunctionExtrapolation() Constructor Taking Over A Mapped File, Its Lines Parsed And Its Text Lexed
+     *
+     * @param fileSource MappedSource
+     * @param displayFunctions Boolean, Print The Functions Found
+     * @param statistics AnalysisStatistics, Records The Parse When Not Null
+     * @param threads Unsigned Int, Workers Parsing The File When It Is Large Enough, Zero Uses One Per Hardware
+     * Thread
+     */
+    explicit FunctionExtrapolation(MappedSource &&fileSource, bool displayFunctions = true,
+                                   AnalysisStatistics *statistics = nullptr, unsigned int threads = 1);
+
+    /**
+     * attachSource() Take Over The Mapped File Of Functions Loaded Without One And Lex It For Their Tokens
+     *
+     * @param fileSource MappedSource
+     */
+    void attachSource(MappedSource &&fileSource);
+
+    /**
+     * formulateFuncExpressions() Formulate the FunctionExpression Abstraction List, Lines Numbered From One
      *
      * @param sourceCodeList vector<string>
      */
     void formulateFuncExpressions(const vector<string> &sourceCodeList);
 
+    /**
+     * formulateFuncExpressions() Formulate the FunctionExpression Abstraction List, Keeping Original Line Numbers
+     *
+     * @param sourceLines vector<SourceLine>
+     */
+    void formulateFuncExpressions(const vector<SourceLine> &sourceLines);
+
+    /**
+     * mergeFunctions() Move Another File's Functions, Tokens And Mapping Into This Index, Tagged With Their Path
+     *
+     * @param fileFunctions FunctionExtrapolation
+     * @param filePath String
+     */
+    void mergeFunctions(FunctionExtrapolation &&fileFunctions, const string &filePath);
+
+    /**
+     * getNumOfFunctions() Total Number of Functions
+     *
+     * @return Int
+     */
+    int getNumOfFunctions() const;
+
+    /**
+     * getFunctions() Functions Found, In Source Order
+     *
+     * @return vector<FunctionExpression>
+     */
+    const vector<FunctionExpression> &getFunctions() const;
+
+    /**
+     * getMetrics() Metrics Of Every Function, Rows In getFunctions() Order
+     *
+     * @return MetricsTable
+     */
+    const MetricsTable &getMetrics() const;
+
+    /**
+     * getTokenPool() Pool Naming The Ids Of Every Interned Token Set
+     *
+     * @return TokenPool
+     */
+    const TokenPool &getTokenPool() const;
+
+    /**
+     * getFunctionTokens() Lexical Tokens Of A Function, Empty When Built Without A MappedSource
+     *
+     * @param funcExpr FunctionExpression
+     * @return span<const SourceToken>
+     */
+    span<const SourceToken> getFunctionTokens(const FunctionExpression &funcExpr) const;
+
+    /**
+     * getExactBodyTokens() Tokens The Exact Match Pass Compares, From The Parameters On, The Name Left Out. Taken
+     * From The Function's Lexical Tokens, Or Lexed From Its Text When It Has None (Read From The Cache)
+     *
+     * @param funcExpr FunctionExpression
+     * @param bodyText String, Holds The Text Lexed In One Piece, So Comments Spanning Lines Stay Whole
+     * @param textTokens vector<SourceToken>, Holds The Tokens Lexed From bodyText
+     * @return span<const SourceToken>, Comments And Preprocessor Lines Included
+     */
+    span<const SourceToken> getExactBodyTokens(const FunctionExpression &funcExpr, string &bodyText,
+                                               vector<SourceToken> &textTokens) const;
+
+    /**
+     * setDuplicateEngine() Choose How Duplicate Functions Are Found
+     *
+     * @param engine DuplicateEngine
+     */
+    void setDuplicateEngine(DuplicateEngine engine);
+
+    /**
+     * setExactMatchMode() Group Exact Duplicates By Hash Before findCloneClasses() Runs Its Engine
+     *
+     * @param mode ExactMatchMode
+     */
+    void setExactMatchMode(ExactMatchMode mode);
+
+    /**
+     * setNumOfThreads() Workers Parsing Large Files And Verifying Duplicate Candidates
+     *
+     * @param threads Unsigned Int, Zero Uses One Per Hardware Thread
+     */
+    void setNumOfThreads(unsigned int threads);
+
+    /**
+     * setStatistics() Record Phase Times And Counters Of Later Work, Null Disables Them
+     *
+     * @param statistics AnalysisStatistics, Owned By The Caller
+     */
+    void setStatistics(AnalysisStatistics *statistics);
+
+    /**
+     * internFunctionTokens() Give Every Function Not Yet Interned Its Token Set
+     */
+    void internFunctionTokens();
+
+    /**
+     * computeSignatures() Intern Token Sets And Give Every Function Without One Its MinHash Signature
+     */
+    void computeSignatures();
+
+    /**
+     * findDuplicatePairs() Index Pairs (i < j) Of Duplicate Functions, In Pairwise Comparison Order
+     *
+     * @return vector<pair<int, int>>
+     */
+    vector<pair<int, int>> findDuplicatePairs();
+
+    /**
+     * findCloneClasses() Duplicate Functions Grouped Transitively, Comparisons Inside A Confirmed Class Skipped
+     *
+     * @return vector<vector<int>> Function Indexes, Each Class Sorted, Ordered By Its First Function
+     */
+    vector<vector<int>> findCloneClasses();
+
+    /**
+     * findMetricRows() Functions A Metric Report Flags
+     *
+     * @param reportType ReportType, REPORT_LONG_FUNCS, REPORT_LONG_PARAMS Or REPORT_COMPLEX_FUNCS
+     * @return vector<int> Function Indexes, Ascending
+     */
+    vector<int> findMetricRows(ReportType reportType) const;
+
+    /**
+     * writeReport() Send A Report To A Sink, Each Result As It Is Found
+     *
+     * @param reportType ReportType
+     * @param reportSink ReportSink
+     */
+    void writeReport(ReportType reportType, ReportSink &reportSink);
+
     /**
      * printFuncExpressions() Print All Functions within SLOC
      */
     void printFuncExpressions();
 
     /**
-     * printDuplicateFunc() Print All Duplicate Functions within SLOC
+     * printDuplicateFunc() Print Each Clone Class Of Duplicate Functions Once, With Its Members
      */
     void printDuplicateFunc();
 
+    /**
+     * printCloneFragments() Print Copied Regions Of Code Within And Between Functions, With Their Line Ranges
+     */
+    void printCloneFragments();
+
+    /**
+     * printComplexFunctions() Print All Functions With High Cyclomatic Complexity Or Deep Nesting within SLOC
+     */
+    void printComplexFunctions();
+
     /**
      * printLongParams() Print All Functions with Long Parameter within SLOC
      */
@@ -191,5 +551,4 @@ public:
     void printLongFunction();
 };
 
-
 #endif //FUNCTION_EXTRAPOLATION_H
@@ -0,0 +1,63 @@
+/**
+ * @file FunctionMetrics.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "FunctionMetrics.h"
+
+#include <algorithm>
+#include <numeric>
+
+void MetricsTable::appendRow(const MetricsRow &row) {
+    for (int column = 0; column < NUM_OF_METRICS; column++) {
+        columns[column].push_back(row[column]);
+        descendingRows[column].clear();
+    }
+}
+
+void MetricsTable::appendTable(const MetricsTable &other) {
+    for (int column = 0; column < NUM_OF_METRICS; column++) {
+        columns[column].insert(columns[column].end(), other.columns[column].begin(), other.columns[column].end());
+        descendingRows[column].clear();
+    }
+}
+
+int MetricsTable::getNumOfRows() const {
+    return int(columns[0].size());
+}
+
+int32_t MetricsTable::getValue(int row, MetricColumn column) const {
+    return columns[column].at(row);
+}
+
+MetricsRow MetricsTable::getRow(int row) const {
+    MetricsRow values = {};
+    for (int column = 0; column < NUM_OF_METRICS; column++) {
+        values[column] = columns[column].at(row);
+    }
+    return values;
+}
+
+vector<int> MetricsTable::findRowsAbove(MetricColumn column, int32_t threshold) const {
+    const vector<int32_t> &values = columns[column];
+    vector<int32_t> &order = descendingRows[column];
+    if (order.size() != values.size()) {
+        order.resize(values.size());
+        iota(order.begin(), order.end(), 0);
+        stable_sort(order.begin(), order.end(), [&values](int32_t a, int32_t b) {
+            return values[a] > values[b];
+        });
+    }
+
+    // Matching Rows Are A Prefix Of The Descending Order
+    vector<int> matchingRows = {};
+    for (int32_t row: order) {
+        if (values[row] <= threshold) {
+            break;
+        }
+        matchingRows.push_back(row);
+    }
+    sort(matchingRows.begin(), matchingRows.end());
+    return matchingRows;
+}
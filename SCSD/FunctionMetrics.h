@@ -0,0 +1,90 @@
+/**
+ * @file FunctionMetrics.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Per-Function Metrics, Measured Once While Parsing And Stored Column By Column
+ */
+
+#ifndef FUNCTION_METRICS_H
+#define FUNCTION_METRICS_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @enum MetricColumn
+ * @details One Column Of The MetricsTable
+ */
+enum MetricColumn {
+    METRIC_PARAMS, METRIC_LENGTH, METRIC_NESTING, METRIC_CYCLOMATIC, METRIC_TOKENS, NUM_OF_METRICS
+};
+
+// Every Metric Of One Function, Indexed By MetricColumn
+using MetricsRow = array<int32_t, NUM_OF_METRICS>;
+
+/**
+ * @class MetricsTable
+ * @details One Row Per Function, Each Metric In Its Own Column, Threshold Queries Cost O(matches) Once A
+ * Column's Descending Order Is Built
+ */
+class MetricsTable {
+private:
+    // Metric Values, One Column Per MetricColumn
+    array<vector<int32_t>, NUM_OF_METRICS> columns = {};
+    // Rows Of Each Column By Decreasing Value, Built By The First Query, Dropped When Rows Are Added
+    mutable array<vector<int32_t>, NUM_OF_METRICS> descendingRows = {};
+
+public:
+    /**
+     * appendRow() Add The Metrics Of The Next Function
+     *
+     * @param row MetricsRow
+     */
+    void appendRow(const MetricsRow &row);
+
+    /**
+     * appendTable() Add Every Row Of Another Table, After These
+     *
+     * @param other MetricsTable
+     */
+    void appendTable(const MetricsTable &other);
+
+    /**
+     * getNumOfRows() Number of Functions Measured
+     *
+     * @return Int
+     */
+    int getNumOfRows() const;
+
+    /**
+     * getValue() One Metric Of One Function
+     *
+     * @param row Int
+     * @param column MetricColumn
+     * @return int32_t
+     */
+    int32_t getValue(int row, MetricColumn column) const;
+
+    /**
+     * getRow() Every Metric Of One Function
+     *
+     * @param row Int
+     * @return MetricsRow
+     */
+    MetricsRow getRow(int row) const;
+
+    /**
+     * findRowsAbove() Rows Whose Metric Exceeds A Threshold
+     *
+     * @param column MetricColumn
+     * @param threshold int32_t
+     * @return vector<int>, In Row Order
+     */
+    vector<int> findRowsAbove(MetricColumn column, int32_t threshold) const;
+};
+
+#endif //FUNCTION_METRICS_H
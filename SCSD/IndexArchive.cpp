@@ -0,0 +1,482 @@
+/**
+ * @file IndexArchive.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "IndexArchive.h"
+
+#include <array>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+static_assert(sizeof(IndexHeader) % alignof(uint64_t) == 0);
+static_assert(sizeof(IndexBlockEntry) % alignof(uint64_t) == 0);
+
+/**
+ * appendVarint() Append An Unsigned Integer, Seven Bits Per Byte, Low Bits First
+ *
+ * @param bytes String
+ * @param value uint64_t
+ */
+static void appendVarint(string &bytes, uint64_t value) {
+    while (value >= 0x80) {
+        bytes.push_back(char((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back(char(value));
+}
+
+/**
+ * appendSigned() Append A Signed Integer As A Zigzag Varint, Small Magnitudes Stay Short
+ *
+ * @param bytes String
+ * @param value int64_t
+ */
+static void appendSigned(string &bytes, int64_t value) {
+    appendVarint(bytes, (uint64_t(value) << 1) ^ uint64_t(value >> 63));
+}
+
+/**
+ * appendText() Append A Length Prefixed Piece Of Text
+ *
+ * @param bytes String
+ * @param text string_view
+ */
+static void appendText(string &bytes, string_view text) {
+    appendVarint(bytes, text.size());
+    bytes.append(text);
+}
+
+/**
+ * readVarint() Read An Unsigned Integer Written By appendVarint()
+ *
+ * @param bytes string_view
+ * @param position size_t, Advanced
+ * @param value uint64_t
+ * @return Boolean, False When The Block Ends First
+ */
+static bool readVarint(string_view bytes, size_t &position, uint64_t &value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && position < bytes.size(); shift += 7) {
+        uint8_t byte = uint8_t(bytes[position++]);
+        value |= uint64_t(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * readSigned() Read A Signed Integer Written By appendSigned()
+ *
+ * @param bytes string_view
+ * @param position size_t, Advanced
+ * @param value int64_t
+ * @return Boolean, False When The Block Ends First
+ */
+static bool readSigned(string_view bytes, size_t &position, int64_t &value) {
+    uint64_t zigzag = 0;
+    if (!readVarint(bytes, position, zigzag)) {
+        return false;
+    }
+    value = int64_t(zigzag >> 1) ^ -int64_t(zigzag & 1);
+    return true;
+}
+
+/**
+ * readText() Read Text Written By appendText()
+ *
+ * @param bytes string_view
+ * @param position size_t, Advanced
+ * @param text String
+ * @return Boolean, False When The Block Ends First
+ */
+static bool readText(string_view bytes, size_t &position, string &text) {
+    uint64_t length = 0;
+    if (!readVarint(bytes, position, length) || length > bytes.size() - position) {
+        return false;
+    }
+    text.assign(bytes.substr(position, length));
+    position += length;
+    return true;
+}
+
+/**
+ * getSectionBlocks() Blocks Needed For A Number Of Items
+ *
+ * @param numOfItems uint32_t
+ * @param itemsPerBlock uint32_t
+ * @return uint32_t
+ */
+static uint32_t getSectionBlocks(uint32_t numOfItems, uint32_t itemsPerBlock) {
+    return (numOfItems + itemsPerBlock - 1) / itemsPerBlock;
+}
+
+IndexArchive::~IndexArchive() {
+    if (indexDescriptor >= 0) {
+        close(indexDescriptor);
+    }
+}
+
+void IndexArchive::encodeBlock(string_view rawBlock, IndexBlockEntry &blockEntry, string &storedBlocks) {
+    auto rawBytes = reinterpret_cast<const unsigned char *>(rawBlock.data());
+    uint64_t counts[SYMBOL_COUNT];
+    HuffmanTreeBuilder::CountHistogram(rawBytes, rawBlock.size(), counts);
+
+    string codedBlock = {};
+    HuffmanCodebook codebook;
+    if (codebook.BuildFromCounts(counts)) {
+        codedBlock.append(reinterpret_cast<const char *>(codebook.Lengths()), SYMBOL_COUNT);
+        codebook.EncodeBlock(rawBytes, rawBlock.size(), codedBlock);
+    }
+    blockEntry.rawSize = uint32_t(rawBlock.size());
+    blockEntry.checksum = Crc32c(0, rawBytes, rawBlock.size());
+    blockEntry.isCoded = !codedBlock.empty() && codedBlock.size() < rawBlock.size();
+    blockEntry.storedSize = uint32_t(blockEntry.isCoded ? codedBlock.size() : rawBlock.size());
+    storedBlocks.append(blockEntry.isCoded ? string_view(codedBlock) : rawBlock);
+}
+
+uint64_t IndexArchive::saveIndex(const FunctionExtrapolation &functionIndex, const string &indexPath) {
+    const vector<FunctionExpression> &funcExpressions = functionIndex.funcExpressions;
+    const TokenPool &tokenPool = functionIndex.tokenPool;
+    const vector<string> &sourceFiles = functionIndex.sourceFiles;
+    if (funcExpressions.size() > numeric_limits<uint32_t>::max() ||
+        sourceFiles.size() > numeric_limits<uint32_t>::max()) {
+        return 0;
+    }
+
+    // Raw Blocks Of Each Section, Item i Goes To Block i / Items Per Block
+    array<vector<string>, NUM_OF_INDEX_SECTIONS> rawBlocks = {};
+    auto getBlock = [&rawBlocks](IndexSection section, size_t item, uint32_t itemsPerBlock) -> string & {
+        if (item % itemsPerBlock == 0) {
+            rawBlocks[section].emplace_back();
+        }
+        return rawBlocks[section].back();
+    };
+    for (size_t p = 0; p < sourceFiles.size(); p++) {
+        appendText(getBlock(INDEX_PATHS, p, INDEX_PATHS_PER_BLOCK), sourceFiles[p]);
+    }
+    for (uint32_t tokenId = 0; tokenId < tokenPool.getNumOfTokens(); tokenId++) {
+        appendText(getBlock(INDEX_TOKENS, tokenId, INDEX_TOKENS_PER_BLOCK), tokenPool.getToken(tokenId));
+    }
+    // Each Function's Stream Is Rebuilt From Its Composition, The Same Tokens Its Token Set Was Interned From
+    SourceArena streamArena;
+    vector<string_view> funCompose = {};
+    uint32_t tokenId = 0;
+    for (size_t i = 0; i < funcExpressions.size(); i++) {
+        const FunctionExpression &funcExpr = funcExpressions[i];
+        string &functionBlock = getBlock(INDEX_FUNCTIONS, i, INDEX_FUNCS_PER_BLOCK);
+        appendText(functionBlock, funcExpr.funcName);
+        appendText(functionBlock, funcExpr.funcParams);
+        appendVarint(functionBlock, uint64_t(int64_t(funcExpr.fileIndex) + 1));
+        appendSigned(functionBlock, funcExpr.stLine);
+        appendSigned(functionBlock, int64_t(funcExpr.endLine) - funcExpr.stLine);
+        for (int32_t metric: functionIndex.functionMetrics.getRow(int(i))) {
+            appendSigned(functionBlock, metric);
+        }
+
+        funCompose.clear();
+        funcExpr.getExtrapolatedComposition(funCompose, streamArena);
+        string &tokenStreamBlock = getBlock(INDEX_TOKEN_STREAMS, i, INDEX_FUNCS_PER_BLOCK);
+        appendVarint(tokenStreamBlock, funCompose.size());
+        for (string_view token: funCompose) {
+            if (!tokenPool.find(token, tokenId)) {
+                return 0;
+            }
+            appendVarint(tokenStreamBlock, tokenId);
+        }
+    }
+
+    IndexHeader header{};
+    memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    header.version = INDEX_FORMAT_VERSION;
+    header.numOfFunctions = uint32_t(funcExpressions.size());
+    header.numOfTokens = tokenPool.getNumOfTokens();
+    header.numOfPaths = uint32_t(sourceFiles.size());
+    for (int section = 0; section < NUM_OF_INDEX_SECTIONS; section++) {
+        header.firstBlock[section] = header.numOfBlocks;
+        header.numOfBlocks += uint32_t(rawBlocks[section].size());
+    }
+
+    vector<IndexBlockEntry> blockDirectory = {};
+    string storedBlocks = {};
+    uint64_t blocksOffset = sizeof(header) + uint64_t(header.numOfBlocks) * sizeof(IndexBlockEntry);
+    for (const vector<string> &sectionBlocks: rawBlocks) {
+        for (const string &rawBlock: sectionBlocks) {
+            if (rawBlock.size() > numeric_limits<uint32_t>::max()) {
+                return 0;
+            }
+            IndexBlockEntry &blockEntry = blockDirectory.emplace_back();
+            blockEntry.offset = blocksOffset + storedBlocks.size();
+            encodeBlock(rawBlock, blockEntry, storedBlocks);
+        }
+    }
+
+    // Written Beside The Index And Renamed Over It, A Reader Never Sees Half An Index
+    string tempPath = indexPath + ".tmp" + to_string(getpid());
+    {
+        ofstream indexFile(tempPath, ios::binary | ios::trunc);
+        indexFile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        indexFile.write(reinterpret_cast<const char *>(blockDirectory.data()),
+                        streamsize(blockDirectory.size() * sizeof(IndexBlockEntry)));
+        indexFile.write(storedBlocks.data(), streamsize(storedBlocks.size()));
+        if (!indexFile.flush()) {
+            indexFile.close();
+            error_code removeError;
+            fs::remove(tempPath, removeError);
+            return 0;
+        }
+    }
+    error_code renameError;
+    fs::rename(tempPath, indexPath, renameError);
+    if (renameError) {
+        fs::remove(tempPath, renameError);
+        return 0;
+    }
+    return blocksOffset + storedBlocks.size();
+}
+
+bool IndexArchive::open(const string &indexPath) {
+    if (indexDescriptor >= 0) {
+        close(indexDescriptor);
+    }
+    decodedBlocks.clear();
+    blockDirectory.clear();
+    numOfBytesRead = 0;
+    indexDescriptor = ::open(indexPath.c_str(), O_RDONLY);
+    if (indexDescriptor < 0) {
+        return false;
+    }
+    error_code sizeError;
+    indexSize = fs::file_size(indexPath, sizeError);
+    if (sizeError || pread(indexDescriptor, &indexHeader, sizeof(indexHeader), 0) != ssize_t(sizeof(indexHeader)) ||
+        memcmp(indexHeader.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 ||
+        indexHeader.version != INDEX_FORMAT_VERSION) {
+        return false;
+    }
+
+    // Each Section Must Hold Exactly The Blocks Its Item Count Needs
+    uint32_t sectionBlocks[NUM_OF_INDEX_SECTIONS] = {
+            getSectionBlocks(indexHeader.numOfPaths, INDEX_PATHS_PER_BLOCK),
+            getSectionBlocks(indexHeader.numOfTokens, INDEX_TOKENS_PER_BLOCK),
+            getSectionBlocks(indexHeader.numOfFunctions, INDEX_FUNCS_PER_BLOCK),
+            getSectionBlocks(indexHeader.numOfFunctions, INDEX_FUNCS_PER_BLOCK)};
+    uint32_t expectedBlock = 0;
+    for (int section = 0; section < NUM_OF_INDEX_SECTIONS; section++) {
+        if (indexHeader.firstBlock[section] != expectedBlock) {
+            return false;
+        }
+        expectedBlock += sectionBlocks[section];
+    }
+    uint64_t directoryBytes = uint64_t(indexHeader.numOfBlocks) * sizeof(IndexBlockEntry);
+    if (expectedBlock != indexHeader.numOfBlocks || sizeof(indexHeader) + directoryBytes > indexSize) {
+        return false;
+    }
+    blockDirectory.resize(indexHeader.numOfBlocks);
+    if (pread(indexDescriptor, blockDirectory.data(), directoryBytes, sizeof(indexHeader)) != ssize_t(directoryBytes)) {
+        return false;
+    }
+    for (const IndexBlockEntry &blockEntry: blockDirectory) {
+        if (blockEntry.offset > indexSize || blockEntry.storedSize > indexSize - blockEntry.offset) {
+            return false;
+        }
+    }
+    numOfBytesRead = sizeof(indexHeader) + directoryBytes;
+    return true;
+}
+
+const string *IndexArchive::readBlock(IndexSection section, uint32_t block) {
+    uint32_t entry = indexHeader.firstBlock[section] + block;
+    auto decoded = decodedBlocks.find(entry);
+    if (decoded != decodedBlocks.end()) {
+        return &decoded->second;
+    }
+    if (entry >= blockDirectory.size() || (section + 1 < NUM_OF_INDEX_SECTIONS &&
+                                           entry >= indexHeader.firstBlock[section + 1])) {
+        return nullptr;
+    }
+
+    const IndexBlockEntry &blockEntry = blockDirectory[entry];
+    string storedBlock(blockEntry.storedSize, '\0');
+    if (pread(indexDescriptor, storedBlock.data(), storedBlock.size(), off_t(blockEntry.offset)) !=
+        ssize_t(storedBlock.size())) {
+        return nullptr;
+    }
+    numOfBytesRead += storedBlock.size();
+
+    string rawBlock = {};
+    if (!blockEntry.isCoded) {
+        rawBlock = std::move(storedBlock);
+    } else {
+        HuffmanCodebook codebook;
+        auto storedBytes = reinterpret_cast<const unsigned char *>(storedBlock.data());
+        if (storedBlock.size() < SYMBOL_COUNT || !codebook.SetLengths(storedBytes) ||
+            !codebook.DecodeBlock(storedBytes + SYMBOL_COUNT, storedBlock.size() - SYMBOL_COUNT, blockEntry.rawSize,
+                                  rawBlock)) {
+            return nullptr;
+        }
+    }
+    // A Damaged Block Can Still Decode, Only Its Checksum Tells
+    if (rawBlock.size() != blockEntry.rawSize ||
+        Crc32c(0, reinterpret_cast<const unsigned char *>(rawBlock.data()), rawBlock.size()) != blockEntry.checksum) {
+        return nullptr;
+    }
+    return &decodedBlocks.emplace(entry, std::move(rawBlock)).first->second;
+}
+
+bool IndexArchive::readFunctions(uint32_t block, vector<ArchivedFunction> &blockFunctions,
+                                 vector<uint32_t> &pathNumbers) {
+    const string *functionBlock = readBlock(INDEX_FUNCTIONS, block);
+    if (functionBlock == nullptr) {
+        return false;
+    }
+    pathNumbers.clear();
+    uint32_t firstFunction = block * INDEX_FUNCS_PER_BLOCK;
+    blockFunctions.resize(min(INDEX_FUNCS_PER_BLOCK, indexHeader.numOfFunctions - firstFunction));
+    size_t position = 0;
+    for (ArchivedFunction &archivedFunction: blockFunctions) {
+        uint64_t pathNumber = 0;
+        int64_t stLine = 0, numOfLines = 0, metric = 0;
+        if (!readText(*functionBlock, position, archivedFunction.funcName) ||
+            !readText(*functionBlock, position, archivedFunction.funcParams) ||
+            !readVarint(*functionBlock, position, pathNumber) || pathNumber > indexHeader.numOfPaths ||
+            !readSigned(*functionBlock, position, stLine) || !readSigned(*functionBlock, position, numOfLines)) {
+            return false;
+        }
+        archivedFunction.stLine = int(stLine);
+        archivedFunction.endLine = int(stLine + numOfLines);
+        for (int32_t &metricValue: archivedFunction.metrics) {
+            if (!readSigned(*functionBlock, position, metric)) {
+                return false;
+            }
+            metricValue = int32_t(metric);
+        }
+
+        pathNumbers.push_back(uint32_t(pathNumber));
+    }
+    return true;
+}
+
+bool IndexArchive::readPath(uint32_t pathNumber, string &filePath) {
+    filePath.clear();
+    if (pathNumber == 0) {
+        return true;
+    }
+    uint32_t pathIndex = pathNumber - 1;
+    const string *pathBlock = readBlock(INDEX_PATHS, pathIndex / INDEX_PATHS_PER_BLOCK);
+    size_t position = 0;
+    for (uint32_t p = 0; p <= pathIndex % INDEX_PATHS_PER_BLOCK; p++) {
+        if (pathBlock == nullptr || !readText(*pathBlock, position, filePath)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int IndexArchive::getNumOfFunctions() const {
+    return int(indexHeader.numOfFunctions);
+}
+
+bool IndexArchive::findFunctions(string_view funcName, vector<int> &foundFunctions) {
+    foundFunctions.clear();
+    vector<ArchivedFunction> blockFunctions = {};
+    vector<uint32_t> pathNumbers = {};
+    uint32_t numOfFunctionBlocks = getSectionBlocks(indexHeader.numOfFunctions, INDEX_FUNCS_PER_BLOCK);
+    for (uint32_t block = 0; block < numOfFunctionBlocks; block++) {
+        if (!readFunctions(block, blockFunctions, pathNumbers)) {
+            return false;
+        }
+        for (size_t i = 0; i < blockFunctions.size(); i++) {
+            // "int area" Is Also Found As "area"
+            string_view storedName = blockFunctions[i].funcName;
+            string_view bareName = storedName.substr(storedName.find_last_of(" *&") + 1);
+            if (storedName == funcName || bareName == funcName) {
+                foundFunctions.push_back(int(block * INDEX_FUNCS_PER_BLOCK + i));
+            }
+        }
+    }
+    return true;
+}
+
+bool IndexArchive::readFunction(int function, ArchivedFunction &archivedFunction, bool withTokens) {
+    if (function < 0 || uint32_t(function) >= indexHeader.numOfFunctions) {
+        return false;
+    }
+    uint32_t block = uint32_t(function) / INDEX_FUNCS_PER_BLOCK;
+    uint32_t slot = uint32_t(function) % INDEX_FUNCS_PER_BLOCK;
+    vector<ArchivedFunction> blockFunctions = {};
+    vector<uint32_t> pathNumbers = {};
+    if (!readFunctions(block, blockFunctions, pathNumbers)) {
+        return false;
+    }
+    archivedFunction = std::move(blockFunctions[slot]);
+    archivedFunction.tokenStream.clear();
+    archivedFunction.tokenSet.clear();
+    if (!readPath(pathNumbers[slot], archivedFunction.filePath)) {
+        return false;
+    }
+    if (!withTokens) {
+        return true;
+    }
+
+    const string *tokenStreamBlock = readBlock(INDEX_TOKEN_STREAMS, block);
+    if (tokenStreamBlock == nullptr) {
+        return false;
+    }
+    size_t position = 0;
+    for (uint32_t s = 0; s <= slot; s++) {
+        uint64_t streamSize = 0, tokenId = 0;
+        if (!readVarint(*tokenStreamBlock, position, streamSize) ||
+            streamSize > tokenStreamBlock->size() - position) {
+            return false;
+        }
+        archivedFunction.tokenStream.clear();
+        for (uint64_t t = 0; t < streamSize; t++) {
+            if (!readVarint(*tokenStreamBlock, position, tokenId) || tokenId >= indexHeader.numOfTokens) {
+                return false;
+            }
+            archivedFunction.tokenStream.push_back(uint32_t(tokenId));
+        }
+    }
+    archivedFunction.tokenSet = archivedFunction.tokenStream;
+    toTokenSet(archivedFunction.tokenSet);
+    return true;
+}
+
+bool IndexArchive::getToken(uint32_t tokenId, string &token) {
+    if (tokenId >= indexHeader.numOfTokens) {
+        return false;
+    }
+    const string *tokenBlock = readBlock(INDEX_TOKENS, tokenId / INDEX_TOKENS_PER_BLOCK);
+    size_t position = 0;
+    for (uint32_t t = 0; t <= tokenId % INDEX_TOKENS_PER_BLOCK; t++) {
+        if (tokenBlock == nullptr || !readText(*tokenBlock, position, token)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int IndexArchive::getNumOfBlocks() const {
+    return int(indexHeader.numOfBlocks);
+}
+
+int IndexArchive::getNumOfBlocksRead() const {
+    return int(decodedBlocks.size());
+}
+
+uint64_t IndexArchive::getNumOfBytesRead() const {
+    return numOfBytesRead;
+}
+
+uint64_t IndexArchive::getIndexSize() const {
+    return indexSize;
+}
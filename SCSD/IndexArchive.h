@@ -0,0 +1,236 @@
+/**
+ * @file IndexArchive.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Persisted Function Index, Its Sections Cut Into Blocks Each Huffman Coded On Its Own, So A Lookup Reads And
+ * Decodes Only The Blocks It Touches
+ */
+
+#ifndef INDEX_ARCHIVE_H
+#define INDEX_ARCHIVE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "../ParallelHuffman/HuffmanCodebook.h"
+#include "FunctionExtrapolation.h"
+
+using namespace std;
+
+const char INDEX_MAGIC[8] = {'S', 'C', 'S', 'D', 'P', 'A', 'C', 'K'};
+const uint32_t INDEX_FORMAT_VERSION = 2;
+// Functions Per Function Block, Their Token Streams Share One Token Stream Block
+const uint32_t INDEX_FUNCS_PER_BLOCK = 256;
+// Interned Tokens Per Token Table Block
+const uint32_t INDEX_TOKENS_PER_BLOCK = 1024;
+// Source Paths Per Path Block
+const uint32_t INDEX_PATHS_PER_BLOCK = 256;
+
+/**
+ * @enum IndexSection
+ * @details Kinds Of Block, In File Order
+ */
+enum IndexSection {
+    INDEX_PATHS, INDEX_TOKENS, INDEX_FUNCTIONS, INDEX_TOKEN_STREAMS, NUM_OF_INDEX_SECTIONS
+};
+
+/**
+ * @struct IndexHeader
+ * @details Start Of The File, Followed By The Block Directory And Then Every Block, In Host (Little Endian) Order
+ */
+struct IndexHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t numOfFunctions;
+    uint32_t numOfTokens;
+    uint32_t numOfPaths;
+    // Directory Entry Of Each Section's First Block, Sections Are Contiguous
+    uint32_t firstBlock[NUM_OF_INDEX_SECTIONS];
+    uint32_t numOfBlocks;
+    uint32_t reserved;
+};
+
+/**
+ * @struct IndexBlockEntry
+ * @details Where A Block Is Stored. A Coded Block Holds SYMBOL_COUNT Code Lengths And Then Its Bits, A Block That
+ * Coding Would Not Shrink Is Stored As Is
+ */
+struct IndexBlockEntry {
+    uint64_t offset;
+    uint32_t storedSize;
+    uint32_t rawSize;
+    uint32_t isCoded;
+    // CRC32C Of The Raw Block, Checked Each Time The Block Is Decoded
+    uint32_t checksum;
+};
+
+/**
+ * @struct ArchivedFunction
+ * @details A Function Read Back From The Index
+ */
+struct ArchivedFunction {
+    string funcName;
+    string funcParams;
+    // Empty When The Function Was Not Read From A File
+    string filePath;
+    int stLine = 0;
+    int endLine = 0;
+    MetricsRow metrics = {};
+    // Interned Token Ids In Source Order, Repeats Kept, Only Filled When Asked For
+    vector<uint32_t> tokenStream = {};
+    // The Token Stream Sorted Without Repeats
+    vector<uint32_t> tokenSet = {};
+};
+
+/**
+ * @class IndexArchive
+ * @details Writes A FunctionExtrapolation As Blocks Of Source Paths, Interned Tokens, Function Descriptions
+ * (Name, Parameters, Lines And Metrics) And Token Streams, Integers As Varints. Reading Only Loads The Header And
+ * Directory; Each Block Is Read With One pread, Decoded And Checked The First Time It Is Needed
+ */
+class IndexArchive {
+private:
+    // Open Index, -1 When None Is
+    int indexDescriptor = -1;
+    uint64_t indexSize = 0;
+    IndexHeader indexHeader = {};
+    vector<IndexBlockEntry> blockDirectory = {};
+    // Decoded Blocks By Directory Entry
+    unordered_map<uint32_t, string> decodedBlocks = {};
+    // Bytes Read From The File, Header And Directory Included
+    uint64_t numOfBytesRead = 0;
+
+    /**
+     * encodeBlock() Huffman Code A Block, Or Keep It As Is When Coding Does Not Shrink It
+     *
+     * @param rawBlock string_view
+     * @param blockEntry IndexBlockEntry, Sizes, isCoded And checksum Filled
+     * @param storedBlocks String, The Stored Block Is Appended
+     */
+    static void encodeBlock(string_view rawBlock, IndexBlockEntry &blockEntry, string &storedBlocks);
+
+    /**
+     * readBlock() A Block's Raw Bytes, Read And Decoded On First Use
+     *
+     * @param section IndexSection
+     * @param block uint32_t, Within The Section
+     * @return const string*, Null When The Block Is Missing, Does Not Decode Or Fails Its Checksum
+     */
+    const string *readBlock(IndexSection section, uint32_t block);
+
+    /**
+     * readFunctions() Decode Every Function Of A Function Block, Without Reading Any Path Or Token Stream Block
+     *
+     * @param block uint32_t
+     * @param blockFunctions vector<ArchivedFunction>, Their Paths And Tokens Left Empty
+     * @param pathNumbers vector<uint32_t>, Each Function's Path Index Plus One, Zero When It Has None
+     * @return Boolean, False When The Block Is Missing Or Damaged
+     */
+    bool readFunctions(uint32_t block, vector<ArchivedFunction> &blockFunctions, vector<uint32_t> &pathNumbers);
+
+    /**
+     * readPath() Source Path Named By A Path Number, Decoding Only Its Path Block
+     *
+     * @param pathNumber uint32_t, Path Index Plus One, Zero For No Path
+     * @param filePath String
+     * @return Boolean, False When The Block Is Missing Or Damaged
+     */
+    bool readPath(uint32_t pathNumber, string &filePath);
+
+public:
+    IndexArchive() = default;
+
+    IndexArchive(const IndexArchive &) = delete;
+
+    IndexArchive &operator=(const IndexArchive &) = delete;
+
+    /**
+     * ~IndexArchive() Close The Index
+     */
+    ~IndexArchive();
+
+    /**
+     * saveIndex() Write Every Function Of An Index, Their Tokens Already Interned
+     *
+     * @param functionIndex FunctionExtrapolation
+     * @param indexPath String, Replaced Whole Or Not At All
+     * @return uint64_t Bytes Written, Zero On Failure
+     */
+    static uint64_t saveIndex(const FunctionExtrapolation &functionIndex, const string &indexPath);
+
+    /**
+     * open() Read The Header And Block Directory Of An Index
+     *
+     * @param indexPath String
+     * @return Boolean, False When The File Is Not A Usable Index
+     */
+    bool open(const string &indexPath);
+
+    /**
+     * getNumOfFunctions() Total Number of Functions
+     *
+     * @return Int
+     */
+    int getNumOfFunctions() const;
+
+    /**
+     * findFunctions() Functions With A Name, Decoding Function Blocks Only
+     *
+     * @param funcName string_view, Compared With The Name As Written, Or With Its Last Word
+     * @param foundFunctions vector<int> Function Indexes, Ascending
+     * @return Boolean, False When A Function Block Is Damaged
+     */
+    bool findFunctions(string_view funcName, vector<int> &foundFunctions);
+
+    /**
+     * readFunction() Read One Function Back
+     *
+     * @param function Int
+     * @param archivedFunction ArchivedFunction
+     * @param withTokens Boolean, Also Decode Its Token Stream Block
+     * @return Boolean, False When Out Of Range Or Damaged
+     */
+    bool readFunction(int function, ArchivedFunction &archivedFunction, bool withTokens);
+
+    /**
+     * getToken() Text Of An Interned Token, Decoding Only Its Token Table Block
+     *
+     * @param tokenId uint32_t
+     * @param token String
+     * @return Boolean, False When Out Of Range Or Damaged
+     */
+    bool getToken(uint32_t tokenId, string &token);
+
+    /**
+     * getNumOfBlocks() Blocks In The Index
+     *
+     * @return Int
+     */
+    int getNumOfBlocks() const;
+
+    /**
+     * getNumOfBlocksRead() Blocks Read And Decoded So Far
+     *
+     * @return Int
+     */
+    int getNumOfBlocksRead() const;
+
+    /**
+     * getNumOfBytesRead() Bytes Read From The Index So Far
+     *
+     * @return uint64_t
+     */
+    uint64_t getNumOfBytesRead() const;
+
+    /**
+     * getIndexSize() Size Of The Index File
+     *
+     * @return uint64_t
+     */
+    uint64_t getIndexSize() const;
+};
+
+#endif //INDEX_ARCHIVE_H
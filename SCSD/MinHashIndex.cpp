@@ -0,0 +1,88 @@
+/**
+ * @file MinHashIndex.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "MinHashIndex.h"
+
+#include <algorithm>
+#include <limits>
+
+uint64_t MinHashIndex::mixHash(uint64_t hash, uint64_t seed) {
+    hash ^= seed;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 31);
+}
+
+MinHashIndex::MinHashIndex(unsigned int bands, unsigned int rows) {
+    numOfBands = max(1u, bands);
+    rowsPerBand = max(1u, rows);
+    rowSeeds.resize(numOfBands * rowsPerBand);
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (uint64_t &rowSeed: rowSeeds) {
+        seed += 0x9E3779B97F4A7C15ULL;
+        rowSeed = mixHash(seed, 0);
+    }
+}
+
+void MinHashIndex::computeSignature(span<const uint64_t> tokenHashes, span<uint64_t> signature) const {
+    vector<uint64_t> rowMinimums(rowSeeds.size(), numeric_limits<uint64_t>::max());
+    for (uint64_t tokenHash: tokenHashes) {
+        for (size_t r = 0; r < rowSeeds.size(); r++) {
+            rowMinimums[r] = min(rowMinimums[r], mixHash(tokenHash, rowSeeds[r]));
+        }
+    }
+    for (unsigned int b = 0; b < numOfBands; b++) {
+        uint64_t bandHash = b;
+        for (unsigned int r = 0; r < rowsPerBand; r++) {
+            bandHash = mixHash(bandHash, rowMinimums[b * rowsPerBand + r]);
+        }
+        signature[b] = bandHash;
+    }
+}
+
+int MinHashIndex::addSignature(span<const uint64_t> signature) {
+    signatures.insert(signatures.end(), signature.begin(), signature.begin() + numOfBands);
+    return numOfSignatures++;
+}
+
+unsigned int MinHashIndex::getSignatureSize() const {
+    return numOfBands;
+}
+
+vector<pair<int, int>> MinHashIndex::getCandidatePairs() const {
+    vector<pair<int, int>> candidatePairs = {};
+    vector<pair<uint64_t, int>> bandKeys(numOfSignatures);
+
+    for (unsigned int b = 0; b < numOfBands; b++) {
+        for (int i = 0; i < numOfSignatures; i++) {
+            bandKeys[i] = {signatures[size_t(i) * numOfBands + b], i};
+        }
+        sort(bandKeys.begin(), bandKeys.end());
+
+        // Every Pair Within A Run Of Equal Band Keys Is A Candidate
+        size_t runStart = 0;
+        while (runStart < bandKeys.size()) {
+            size_t runEnd = runStart + 1;
+            while (runEnd < bandKeys.size() && bandKeys[runEnd].first == bandKeys[runStart].first) {
+                runEnd += 1;
+            }
+            for (size_t i = runStart; i + 1 < runEnd; i++) {
+                for (size_t j = i + 1; j < runEnd; j++) {
+                    candidatePairs.emplace_back(bandKeys[i].second, bandKeys[j].second);
+                }
+            }
+            runStart = runEnd;
+        }
+    }
+
+    sort(candidatePairs.begin(), candidatePairs.end());
+    candidatePairs.erase(unique(candidatePairs.begin(), candidatePairs.end()), candidatePairs.end());
+    return candidatePairs;
+}
+
+int MinHashIndex::getNumOfSignatures() const {
+    return numOfSignatures;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file MinHashIndex.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * MinHash Signatures Of Function Token Sets, Bucketed By Banded Locality Sensitive Hashing
+ */
+
+#ifndef MIN_HASH_INDEX_H
+#define MIN_HASH_INDEX_H
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+const unsigned short int MINHASH_NUM_OF_BANDS = 32;
+const unsigned short int MINHASH_ROWS_PER_BAND = 4;
+
+/**
+ * @class MinHashIndex
+ * @details One Signature Per Function, Functions Sharing Any Band Of Their Signature Become Candidate Pairs
+ */
+class MinHashIndex {
+private:
+    // Number of Bands
+    unsigned int numOfBands = MINHASH_NUM_OF_BANDS;
+    // Signature Rows Hashed Together Per Band
+    unsigned int rowsPerBand = MINHASH_ROWS_PER_BAND;
+    // One Seed Per Signature Row
+    vector<uint64_t> rowSeeds = {};
+    // Signatures, numOfBands Band Keys Per Function
+    vector<uint64_t> signatures = {};
+    // Number of Signatures Added
+    int numOfSignatures = 0;
+
+    /**
+     * mixHash() Scramble A Hash With A Row Seed, Acts As One Random Permutation
+     *
+     * @param hash uint64_t
+     * @param seed uint64_t
+     * @return uint64_t
+     */
+    static uint64_t mixHash(uint64_t hash, uint64_t seed);
+
+public:
+    /**
+     * MinHashIndex() Constructor To Create Instance of MinHashIndex
+     *
+     * @param bands Unsigned Int
+     * @param rows Unsigned Int, Rows Per Band
+     */
+    explicit MinHashIndex(unsigned int bands = MINHASH_NUM_OF_BANDS, unsigned int rows = MINHASH_ROWS_PER_BAND);
+
+    /**
+     * computeSignature() MinHash Signature Of One Function's Token Set, Each Band's Rows Folded Into One Key
+     *
+     * @param tokenHashes span<const uint64_t>, Content Hashes Of The Tokens, So Signatures Stay Valid Across Runs
+     * @param signature span<uint64_t>, getSignatureSize() Entries
+     */
+    void computeSignature(span<const uint64_t> tokenHashes, span<uint64_t> signature) const;
+
+    /**
+     * addSignature() Store A Signature Computed By computeSignature()
+     *
+     * @param signature span<const uint64_t>, getSignatureSize() Entries
+     * @return Int Index Of The Signature
+     */
+    int addSignature(span<const uint64_t> signature);
+
+    /**
+     * getSignatureSize() Entries Per Signature, One Per Band
+     *
+     * @return Unsigned Int
+     */
+    unsigned int getSignatureSize() const;
+
+    /**
+     * getCandidatePairs() Pairs (i < j) Sharing At Least One Band, Sorted, Without Repeats
+     *
+     * @return vector<pair<int, int>>
+     */
+    vector<pair<int, int>> getCandidatePairs() const;
+
+    /**
+     * getNumOfSignatures() Number of Signatures Added
+     *
+     * @return Int
+     */
+    int getNumOfSignatures() const;
+};
+
+#endif //MIN_HASH_INDEX_H
@@ -0,0 +1,376 @@
+/**
+ * @file ReportSink.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "ReportSink.h"
+#include "CloneDetector.h"
+#include "FunctionExtrapolation.h"
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+
+const string SARIF_SCHEMA = "https://json.schemastore.org/sarif-2.1.0.json";
+
+/**
+ * @struct ReportRule
+ * @details Names A ReportType Takes In Each Format
+ */
+struct ReportRule {
+    // The --report Name, Also The report Member Of JSON Lines
+    string_view reportName;
+    // SARIF Rule Id And Its Short Description, Which Quotes The Threshold In Force
+    string_view ruleId;
+    string ruleText;
+};
+
+/**
+ * formatThreshold() A Threshold As The Reports Print It
+ *
+ * @param threshold Double
+ * @return String
+ */
+static string formatThreshold(double threshold) {
+    ostringstream thresholdText;
+    thresholdText << threshold;
+    return thresholdText.str();
+}
+
+// Indexed By ReportType
+const ReportRule reportRules[] = {
+        {"functions",  "function",            "Function found in the source"},
+        {"long",       "long-function",       "Function longer than " + to_string(FUN_SIZE_MAX) + " lines"},
+        {"params",     "long-parameter-list", "Function with more than " + to_string(FUN_PARAM_THRESHOLD) +
+                                              " parameters"},
+        {"duplicates", "duplicate-function",  "Functions at least " + formatThreshold(JACCARD_INDEX_THRESHOLD) +
+                                              " Jaccard similar, grouped transitively"},
+        {"clones",     "clone-fragment",      "Region of at least " + to_string(CLONE_MIN_TOKENS) +
+                                              " normalized tokens copied elsewhere"},
+        {"complex",    "complex-function",    "Function with cyclomatic complexity above " +
+                                              to_string(FUN_COMPLEXITY_MAX) + " or nesting above " +
+                                              to_string(FUN_NESTING_MAX)},
+};
+
+/**
+ * writeJsonString() Write Text As A Quoted JSON String
+ *
+ * @param writer BufferedWriter
+ * @param text string_view
+ */
+static void writeJsonString(BufferedWriter &writer, string_view text) {
+    const char hexDigits[] = "0123456789abcdef";
+    writer << '"';
+    size_t runStart = 0;
+    for (size_t i = 0; i < text.size(); i++) {
+        auto letter = static_cast<unsigned char>(text[i]);
+        if (letter >= 0x20 && letter != '"' && letter != '\\') {
+            continue;
+        }
+        writer << text.substr(runStart, i - runStart);
+        runStart = i + 1;
+        if (letter == '"' || letter == '\\') {
+            writer << '\\' << char(letter);
+        } else if (letter == '\n') {
+            writer << "\\n";
+        } else if (letter == '\t') {
+            writer << "\\t";
+        } else {
+            writer << "\\u00" << hexDigits[letter >> 4] << hexDigits[letter & 0xF];
+        }
+    }
+    writer << text.substr(runStart) << '"';
+}
+
+/**
+ * getMetricMessage() Metric Values Behind A Metric Report Result
+ *
+ * @param reportType ReportType
+ * @param metrics MetricsRow
+ * @return String
+ */
+static string getMetricMessage(ReportType reportType, const MetricsRow &metrics) {
+    if (reportType == REPORT_LONG_FUNCS) {
+        return "Func Length Size: " + to_string(metrics[METRIC_LENGTH]);
+    }
+    if (reportType == REPORT_LONG_PARAMS) {
+        return "Num Of Parameters: " + to_string(metrics[METRIC_PARAMS]);
+    }
+    return "Cyclomatic Complexity: " + to_string(metrics[METRIC_CYCLOMATIC]) + ", Nesting Depth: " +
+           to_string(metrics[METRIC_NESTING]);
+}
+
+unique_ptr<ReportSink> ReportSink::create(const string &format, BufferedWriter &writer) {
+    if (format == "console") {
+        return make_unique<ConsoleSink>(writer);
+    }
+    if (format == "jsonl") {
+        return make_unique<JsonLinesSink>(writer);
+    }
+    if (format == "sarif") {
+        return make_unique<SarifSink>(writer);
+    }
+    return nullptr;
+}
+
+string_view ReportSink::getReportName(ReportType reportType) {
+    return reportRules[reportType].reportName;
+}
+
+bool ReportSink::finish() {
+    return reportWriter.flush();
+}
+
+void ConsoleSink::writeFunction(const ReportLocation &function) {
+    reportWriter << function.funcName;
+    if (!function.filePath.empty()) {
+        reportWriter << " (" << function.filePath << ':' << function.startLine << ')';
+    }
+}
+
+void ConsoleSink::writeRegion(const ReportLocation &region) {
+    reportWriter << region.funcName << " (";
+    if (region.filePath.empty()) {
+        reportWriter << "lines ";
+    } else {
+        reportWriter << region.filePath << ':';
+    }
+    reportWriter << region.startLine << '-' << region.endLine << ')';
+}
+
+void ConsoleSink::beginReport(ReportType reportType) {
+    switch (reportType) {
+        case REPORT_FUNCTIONS:
+            reportWriter << "\n--List Of Functions From Source Code:--\n";
+            break;
+        case REPORT_LONG_FUNCS:
+            reportWriter << "\n--Long Sized Functions Results: [THRESHOLD " << FUN_SIZE_MAX << "]--\n";
+            break;
+        case REPORT_LONG_PARAMS:
+            reportWriter << "\n--Long Function Parameters Results: [THRESHOLD " << FUN_PARAM_THRESHOLD << "]--\n";
+            break;
+        case REPORT_DUPLICATES:
+            reportWriter << "\n--Duplicate Functions Results: [INDEX-THRESHOLD " << JACCARD_INDEX_THRESHOLD << "]--\n";
+            break;
+        case REPORT_CLONE_FRAGMENTS:
+            reportWriter << "\n--Clone Fragments Results: [MIN-TOKENS " << CLONE_MIN_TOKENS << "]--\n";
+            break;
+        case REPORT_COMPLEX_FUNCS:
+            reportWriter << "\n--Complex Functions Results: [CYCLOMATIC " << FUN_COMPLEXITY_MAX << ", NESTING "
+                         << FUN_NESTING_MAX << "]--\n";
+            break;
+    }
+}
+
+void ConsoleSink::addFunction(const ReportLocation &function) {
+    reportWriter << '\t' << function.funcName << function.funcParams;
+    if (!function.filePath.empty()) {
+        reportWriter << " (" << function.filePath << ':' << function.startLine << ')';
+    }
+    reportWriter << '\n';
+}
+
+void ConsoleSink::addMetricResult(ReportType reportType, const ReportLocation &function, const MetricsRow &metrics) {
+    reportWriter << '\t';
+    writeFunction(function);
+    reportWriter << "\t---> " << getMetricMessage(reportType, metrics) << '\n';
+}
+
+void ConsoleSink::addCloneClass(int classNumber, span<const ReportLocation> members) {
+    reportWriter << "\tClone Class " << classNumber << ": " << members.size() << " Functions\n";
+    for (const ReportLocation &member: members) {
+        reportWriter << "\t\t";
+        writeFunction(member);
+        reportWriter << '\n';
+    }
+}
+
+void ConsoleSink::addCloneFragment(const ReportLocation &region1, const ReportLocation &region2, int numOfTokens) {
+    reportWriter << '\t';
+    writeRegion(region1);
+    reportWriter << " & ";
+    writeRegion(region2);
+    reportWriter << "\t---> Shared Tokens: " << numOfTokens << '\n';
+}
+
+void ConsoleSink::endReport(ReportType reportType, int numOfResults) {
+    if (numOfResults > 0) {
+        return;
+    }
+    switch (reportType) {
+        case REPORT_LONG_FUNCS:
+            reportWriter << "\tNo Long Functions Exists \n";
+            break;
+        case REPORT_LONG_PARAMS:
+            reportWriter << "\tNo Functions With Long Parameters Exists\n";
+            break;
+        case REPORT_DUPLICATES:
+            reportWriter << "\tNo Functions are Duplicate\n";
+            break;
+        case REPORT_CLONE_FRAGMENTS:
+            reportWriter << "\tNo Clone Fragments Exist\n";
+            break;
+        case REPORT_COMPLEX_FUNCS:
+            reportWriter << "\tNo Complex Functions Exists\n";
+            break;
+        default:
+            break;
+    }
+}
+
+void JsonLinesSink::writeLocation(const ReportLocation &location) {
+    reportWriter << "\"function\":";
+    writeJsonString(reportWriter, location.funcName);
+    if (!location.filePath.empty()) {
+        reportWriter << ",\"file\":";
+        writeJsonString(reportWriter, location.filePath);
+    }
+    reportWriter << ",\"line\":" << location.startLine << ",\"endLine\":" << location.endLine;
+}
+
+void JsonLinesSink::beginReport(ReportType /*reportType*/) {
+}
+
+void JsonLinesSink::addFunction(const ReportLocation &function) {
+    reportWriter << "{\"report\":\"functions\",";
+    writeLocation(function);
+    reportWriter << ",\"params\":";
+    writeJsonString(reportWriter, function.funcParams);
+    reportWriter << "}\n";
+}
+
+void JsonLinesSink::addMetricResult(ReportType reportType, const ReportLocation &function,
+                                    const MetricsRow &metrics) {
+    reportWriter << "{\"report\":\"" << reportRules[reportType].reportName << "\",";
+    writeLocation(function);
+    reportWriter << ",\"metrics\":{\"params\":" << metrics[METRIC_PARAMS] << ",\"length\":" << metrics[METRIC_LENGTH]
+                 << ",\"nesting\":" << metrics[METRIC_NESTING] << ",\"cyclomatic\":" << metrics[METRIC_CYCLOMATIC]
+                 << ",\"tokens\":" << metrics[METRIC_TOKENS] << "}}\n";
+}
+
+void JsonLinesSink::addCloneClass(int classNumber, span<const ReportLocation> members) {
+    reportWriter << "{\"report\":\"duplicates\",\"class\":" << classNumber << ",\"functions\":[";
+    for (size_t m = 0; m < members.size(); m++) {
+        reportWriter << (m == 0 ? "{" : ",{");
+        writeLocation(members[m]);
+        reportWriter << '}';
+    }
+    reportWriter << "]}\n";
+}
+
+void JsonLinesSink::addCloneFragment(const ReportLocation &region1, const ReportLocation &region2,
+                                     int numOfTokens) {
+    reportWriter << "{\"report\":\"clones\",\"tokens\":" << numOfTokens << ",\"regions\":[{";
+    writeLocation(region1);
+    reportWriter << "},{";
+    writeLocation(region2);
+    reportWriter << "}]}\n";
+}
+
+void JsonLinesSink::endReport(ReportType /*reportType*/, int /*numOfResults*/) {
+}
+
+void SarifSink::startLog() {
+    if (hasStarted) {
+        return;
+    }
+    hasStarted = true;
+    reportWriter << "{\"version\":\"2.1.0\",\"$schema\":\"" << SARIF_SCHEMA << "\",\"runs\":[{\"tool\":{\"driver\":"
+                 << "{\"name\":\"SCSD\",\"fullName\":\"Simple Code Smell Detector\",\"rules\":[";
+    for (size_t r = 0; r < size(reportRules); r++) {
+        reportWriter << (r == 0 ? "{" : ",{") << "\"id\":\"" << reportRules[r].ruleId
+                     << "\",\"shortDescription\":{\"text\":\"" << reportRules[r].ruleText << "\"}}";
+    }
+    reportWriter << "]}},\"results\":[";
+}
+
+void SarifSink::beginResult(ReportType reportType, string_view message) {
+    startLog();
+    reportWriter << (hasResults ? ",\n{" : "\n{") << "\"ruleId\":\"" << reportRules[reportType].ruleId << "\",";
+    if (reportType == REPORT_FUNCTIONS) {
+        reportWriter << "\"kind\":\"informational\",\"level\":\"none\",";
+    } else {
+        reportWriter << "\"level\":\"warning\",";
+    }
+    reportWriter << "\"message\":{\"text\":";
+    writeJsonString(reportWriter, message);
+    reportWriter << '}';
+    hasResults = true;
+}
+
+void SarifSink::writeLocation(const ReportLocation &location) {
+    reportWriter << '{';
+    if (!location.filePath.empty()) {
+        // Relative Paths Are Valid URI References, Only Characters URIs Reserve Are Escaped
+        string uri = {};
+        const char hexDigits[] = "0123456789ABCDEF";
+        for (char pathLetter: location.filePath) {
+            auto letter = static_cast<unsigned char>(pathLetter);
+            if (isalnum(letter) || letter == '/' || letter == '-' || letter == '.' || letter == '_' || letter == '~') {
+                uri += pathLetter;
+            } else {
+                uri += '%';
+                uri += hexDigits[letter >> 4];
+                uri += hexDigits[letter & 0xF];
+            }
+        }
+        int startLine = max(1, location.startLine);
+        reportWriter << "\"physicalLocation\":{\"artifactLocation\":{\"uri\":";
+        writeJsonString(reportWriter, uri);
+        reportWriter << "},\"region\":{\"startLine\":" << startLine << ",\"endLine\":"
+                     << max(startLine, location.endLine) << "}},";
+    }
+    reportWriter << "\"logicalLocations\":[{\"name\":";
+    writeJsonString(reportWriter, location.funcName);
+    reportWriter << ",\"kind\":\"function\"}]}";
+}
+
+void SarifSink::beginReport(ReportType /*reportType*/) {
+    startLog();
+}
+
+void SarifSink::addFunction(const ReportLocation &function) {
+    beginResult(REPORT_FUNCTIONS, string(function.funcName) + string(function.funcParams));
+    reportWriter << ",\"locations\":[";
+    writeLocation(function);
+    reportWriter << "]}";
+}
+
+void SarifSink::addMetricResult(ReportType reportType, const ReportLocation &function, const MetricsRow &metrics) {
+    beginResult(reportType, getMetricMessage(reportType, metrics));
+    reportWriter << ",\"locations\":[";
+    writeLocation(function);
+    reportWriter << "]}";
+}
+
+void SarifSink::addCloneClass(int classNumber, span<const ReportLocation> members) {
+    beginResult(REPORT_DUPLICATES,
+                "Clone Class " + to_string(classNumber) + ": " + to_string(members.size()) + " Functions");
+    reportWriter << ",\"locations\":[";
+    writeLocation(members.front());
+    reportWriter << "],\"relatedLocations\":[";
+    for (size_t m = 1; m < members.size(); m++) {
+        reportWriter << (m == 1 ? "" : ",");
+        writeLocation(members[m]);
+    }
+    reportWriter << "]}";
+}
+
+void SarifSink::addCloneFragment(const ReportLocation &region1, const ReportLocation &region2, int numOfTokens) {
+    beginResult(REPORT_CLONE_FRAGMENTS, "Shared Tokens: " + to_string(numOfTokens));
+    reportWriter << ",\"locations\":[";
+    writeLocation(region1);
+    reportWriter << "],\"relatedLocations\":[";
+    writeLocation(region2);
+    reportWriter << "]}";
+}
+
+void SarifSink::endReport(ReportType /*reportType*/, int /*numOfResults*/) {
+}
+
+bool SarifSink::finish() {
+    startLog();
+    reportWriter << "\n]}]}\n";
+    return reportWriter.flush();
+}
@@ -0,0 +1,253 @@
+/**
+ * @file ReportSink.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Destinations For Report Results: Console Text, JSON Lines Or SARIF, Written As Results Are Found
+ */
+
+#ifndef REPORT_SINK_H
+#define REPORT_SINK_H
+
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include "BufferedWriter.h"
+#include "FunctionMetrics.h"
+
+using namespace std;
+
+/**
+ * @enum ReportType
+ * @details One Report Of A Scan, In The Order Of The Interactive Commands
+ */
+enum ReportType {
+    REPORT_FUNCTIONS, REPORT_LONG_FUNCS, REPORT_LONG_PARAMS, REPORT_DUPLICATES, REPORT_CLONE_FRAGMENTS,
+    REPORT_COMPLEX_FUNCS
+};
+
+/**
+ * @struct ReportLocation
+ * @details A Function, Or A Region Of One, Its Text Viewing Into Whoever Reports It For The Call's Duration
+ */
+struct ReportLocation {
+    string_view funcName;
+    // Only Filled For REPORT_FUNCTIONS
+    string_view funcParams;
+    // Empty When The Function Was Read From A Single Unnamed Source
+    string_view filePath;
+    int startLine = 0;
+    int endLine = 0;
+};
+
+/**
+ * @class ReportSink
+ * @details Receives Each Report Between beginReport() And endReport(), One Call Per Result, And Formats It Into A
+ * BufferedWriter Straight Away, Nothing Is Collected
+ */
+class ReportSink {
+protected:
+    // Destination, Owned By The Caller
+    BufferedWriter &reportWriter;
+
+public:
+    /**
+     * ReportSink() Constructor To Create Instance of ReportSink
+     *
+     * @param writer BufferedWriter
+     */
+    explicit ReportSink(BufferedWriter &writer) : reportWriter(writer) {
+    }
+
+    virtual ~ReportSink() = default;
+
+    /**
+     * create() Sink For A Format Name
+     *
+     * @param format String, console, jsonl Or sarif
+     * @param writer BufferedWriter
+     * @return unique_ptr<ReportSink>, Null For An Unknown Format
+     */
+    static unique_ptr<ReportSink> create(const string &format, BufferedWriter &writer);
+
+    /**
+     * getReportName() Name Of A Report, As --report Takes It
+     *
+     * @param reportType ReportType
+     * @return string_view
+     */
+    static string_view getReportName(ReportType reportType);
+
+    /**
+     * beginReport() Start A Report
+     *
+     * @param reportType ReportType
+     */
+    virtual void beginReport(ReportType reportType) = 0;
+
+    /**
+     * addFunction() One Function Of REPORT_FUNCTIONS
+     *
+     * @param function ReportLocation
+     */
+    virtual void addFunction(const ReportLocation &function) = 0;
+
+    /**
+     * addMetricResult() One Function Flagged By A Metric Report
+     *
+     * @param reportType ReportType, REPORT_LONG_FUNCS, REPORT_LONG_PARAMS Or REPORT_COMPLEX_FUNCS
+     * @param function ReportLocation
+     * @param metrics MetricsRow
+     */
+    virtual void addMetricResult(ReportType reportType, const ReportLocation &function, const MetricsRow &metrics) = 0;
+
+    /**
+     * addCloneClass() One Class Of Duplicate Functions
+     *
+     * @param classNumber Int, From One
+     * @param members span<const ReportLocation>, In Function Order
+     */
+    virtual void addCloneClass(int classNumber, span<const ReportLocation> members) = 0;
+
+    /**
+     * addCloneFragment() Two Copies Of One Region Of Code
+     *
+     * @param region1 ReportLocation, Lines Of The First Copy
+     * @param region2 ReportLocation, Lines Of The Second Copy
+     * @param numOfTokens Int
+     */
+    virtual void addCloneFragment(const ReportLocation &region1, const ReportLocation &region2, int numOfTokens) = 0;
+
+    /**
+     * endReport() Finish A Report
+     *
+     * @param reportType ReportType
+     * @param numOfResults Int
+     */
+    virtual void endReport(ReportType reportType, int numOfResults) = 0;
+
+    /**
+     * finish() Close The Output Document And Flush The Writer
+     *
+     * @return Boolean, False When A Write Failed
+     */
+    virtual bool finish();
+};
+
+/**
+ * @class ConsoleSink
+ * @details The Readable Text The Interactive Commands Have Always Printed
+ */
+class ConsoleSink : public ReportSink {
+private:
+    /**
+     * writeFunction() Function Name, With Its File And First Line When It Has A File
+     *
+     * @param function ReportLocation
+     */
+    void writeFunction(const ReportLocation &function);
+
+    /**
+     * writeRegion() Function Name With The Lines Of A Region
+     *
+     * @param region ReportLocation
+     */
+    void writeRegion(const ReportLocation &region);
+
+public:
+    using ReportSink::ReportSink;
+
+    void beginReport(ReportType reportType) override;
+
+    void addFunction(const ReportLocation &function) override;
+
+    void addMetricResult(ReportType reportType, const ReportLocation &function, const MetricsRow &metrics) override;
+
+    void addCloneClass(int classNumber, span<const ReportLocation> members) override;
+
+    void addCloneFragment(const ReportLocation &region1, const ReportLocation &region2, int numOfTokens) override;
+
+    void endReport(ReportType reportType, int numOfResults) override;
+};
+
+/**
+ * @class JsonLinesSink
+ * @details One JSON Object Per Result, Each On Its Own Line, Tagged With Its Report Name
+ */
+class JsonLinesSink : public ReportSink {
+private:
+    /**
+     * writeLocation() JSON Members Naming A Function Or Region: function, file, line, endLine
+     *
+     * @param location ReportLocation
+     */
+    void writeLocation(const ReportLocation &location);
+
+public:
+    using ReportSink::ReportSink;
+
+    void beginReport(ReportType reportType) override;
+
+    void addFunction(const ReportLocation &function) override;
+
+    void addMetricResult(ReportType reportType, const ReportLocation &function, const MetricsRow &metrics) override;
+
+    void addCloneClass(int classNumber, span<const ReportLocation> members) override;
+
+    void addCloneFragment(const ReportLocation &region1, const ReportLocation &region2, int numOfTokens) override;
+
+    void endReport(ReportType reportType, int numOfResults) override;
+};
+
+/**
+ * @class SarifSink
+ * @details One SARIF 2.1.0 Log With A Single Run, Its Rules Declared Up Front So Results Stream Into The Open
+ * results Array, Which finish() Closes
+ */
+class SarifSink : public ReportSink {
+private:
+    // Whether The Log Header Has Been Written
+    bool hasStarted = false;
+    // No Comma Before The First Result
+    bool hasResults = false;
+
+    /**
+     * startLog() Write The Log Header, Once
+     */
+    void startLog();
+
+    /**
+     * beginResult() Start One Result Object With Its Rule, Level And Message
+     *
+     * @param reportType ReportType
+     * @param message string_view
+     */
+    void beginResult(ReportType reportType, string_view message);
+
+    /**
+     * writeLocation() One SARIF Location: The File Region And The Function As A Logical Location
+     *
+     * @param location ReportLocation
+     */
+    void writeLocation(const ReportLocation &location);
+
+public:
+    using ReportSink::ReportSink;
+
+    void beginReport(ReportType reportType) override;
+
+    void addFunction(const ReportLocation &function) override;
+
+    void addMetricResult(ReportType reportType, const ReportLocation &function, const MetricsRow &metrics) override;
+
+    void addCloneClass(int classNumber, span<const ReportLocation> members) override;
+
+    void addCloneFragment(const ReportLocation &region1, const ReportLocation &region2, int numOfTokens) override;
+
+    void endReport(ReportType reportType, int numOfResults) override;
+
+    bool finish() override;
+};
+
+#endif //REPORT_SINK_H
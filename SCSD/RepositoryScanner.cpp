@@ -0,0 +1,167 @@
+/**
+ * @file RepositoryScanner.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "RepositoryScanner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+RepositoryScanner::RepositoryScanner(unsigned int threads) {
+    numOfThreads = threads > 0 ? threads : max(1u, thread::hardware_concurrency());
+}
+
+int RepositoryScanner::collectSourceFiles(const string &rootPath) {
+    error_code walkError;
+    if (fs::is_regular_file(rootPath, walkError)) {
+        sourcePaths.push_back(rootPath);
+        return 1;
+    }
+
+    int numOfCollected = 0;
+    fs::recursive_directory_iterator walker(rootPath, fs::directory_options::skip_permission_denied, walkError);
+    for (; !walkError && walker != fs::recursive_directory_iterator(); walker.increment(walkError)) {
+        const fs::directory_entry &entry = *walker;
+        string entryName = entry.path().filename().string();
+        if (entry.is_directory(walkError)) {
+            if (!entryName.empty() && entryName.front() == '.') {
+                walker.disable_recursion_pending();
+            }
+            continue;
+        }
+        if (entry.is_regular_file(walkError) && isSourceFile(entry.path().string())) {
+            sourcePaths.push_back(entry.path().string());
+            numOfCollected += 1;
+        }
+    }
+    sort(sourcePaths.begin(), sourcePaths.end());
+    return numOfCollected;
+}
+
+bool RepositoryScanner::enableCache(const string &cacheDirectory) {
+    analysisCache = make_unique<AnalysisCache>(cacheDirectory);
+    if (!analysisCache->isUsable()) {
+        analysisCache.reset();
+        return false;
+    }
+    return true;
+}
+
+void RepositoryScanner::setLexCacheHits(bool lexHits) {
+    lexCacheHits = lexHits;
+}
+
+void RepositoryScanner::setStatistics(AnalysisStatistics *statistics) {
+    analysisStatistics = statistics;
+}
+
+bool RepositoryScanner::isSourceFile(const string &filePath) {
+    return sourceFileExtensions.contains(fs::path(filePath).extension().string());
+}
+
+unique_ptr<FunctionExtrapolation> RepositoryScanner::parseSourceFile(const string &sourcePath,
+                                                                     MappedSource &fileSource) {
+    {
+        PhaseTimer readTimer(analysisStatistics, PHASE_READ);
+        if (!fileSource.openFile(sourcePath, analysisCache == nullptr)) {
+            return nullptr;
+        }
+    }
+    if (analysisCache == nullptr) {
+        return make_unique<FunctionExtrapolation>(std::move(fileSource), false, analysisStatistics,
+                                                  numOfThreads);
+    }
+
+    size_t contentSize = fileSource.getContents().size();
+    uint64_t contentHash = hashBytes(fileSource.getContents());
+    unique_ptr<FunctionExtrapolation> fileFunctions = analysisCache->loadEntry(contentHash, contentSize);
+    if (fileFunctions == nullptr) {
+        {
+            PhaseTimer readTimer(analysisStatistics, PHASE_READ);
+            fileSource.indexLines();
+        }
+        fileFunctions = make_unique<FunctionExtrapolation>(std::move(fileSource), false, analysisStatistics,
+                                                           numOfThreads);
+        fileFunctions->computeSignatures();
+        analysisCache->storeEntry(*fileFunctions, contentHash, contentSize);
+    } else {
+        fileFunctions->setStatistics(analysisStatistics);
+        if (analysisStatistics != nullptr) {
+            analysisStatistics->addParsed(0, fileFunctions->getNumOfFunctions());
+        }
+        if (lexCacheHits) {
+            fileFunctions->attachSource(std::move(fileSource));
+        }
+    }
+    return fileFunctions;
+}
+
+unique_ptr<FunctionExtrapolation> RepositoryScanner::parseFile(const string &sourcePath) {
+    MappedSource fileSource;
+    return parseSourceFile(sourcePath, fileSource);
+}
+
+vector<unique_ptr<FunctionExtrapolation>> RepositoryScanner::parseFiles() {
+    numOfFailedFiles = 0;
+    return parseFiles(0, sourcePaths.size());
+}
+
+vector<unique_ptr<FunctionExtrapolation>> RepositoryScanner::parseFiles(size_t firstFile, size_t lastFile) {
+    lastFile = min(lastFile, sourcePaths.size());
+    firstFile = min(firstFile, lastFile);
+    vector<unique_ptr<FunctionExtrapolation>> fileResults(lastFile - firstFile);
+    atomic<size_t> nextFile = firstFile;
+    atomic<int> numOfFailed = 0;
+
+    auto parseWorker = [&]() {
+        MappedSource fileSource;
+        for (size_t i = nextFile++; i < lastFile; i = nextFile++) {
+            fileResults[i - firstFile] = parseSourceFile(sourcePaths[i], fileSource);
+            if (fileResults[i - firstFile] == nullptr) {
+                numOfFailed += 1;
+            }
+        }
+    };
+
+    vector<thread> workers = {};
+    unsigned int numOfWorkers = min<unsigned int>(numOfThreads, max<size_t>(1, fileResults.size()));
+    for (unsigned int t = 0; t < numOfWorkers; t++) {
+        workers.emplace_back(parseWorker);
+    }
+    for (thread &worker: workers) {
+        worker.join();
+    }
+    numOfFailedFiles += numOfFailed;
+    return fileResults;
+}
+
+void RepositoryScanner::scanInto(FunctionExtrapolation &globalIndex) {
+    vector<unique_ptr<FunctionExtrapolation>> fileResults = parseFiles();
+
+    // Merge In Path Order, So The Global Index Does Not Depend On Thread Scheduling
+    for (size_t i = 0; i < sourcePaths.size(); i++) {
+        if (fileResults[i] != nullptr) {
+            globalIndex.mergeFunctions(std::move(*fileResults[i]), sourcePaths[i]);
+            fileResults[i].reset();
+        }
+    }
+}
+
+const vector<string> &RepositoryScanner::getSourcePaths() const {
+    return sourcePaths;
+}
+
+int RepositoryScanner::getNumOfFailedFiles() const {
+    return numOfFailedFiles;
+}
+
+const AnalysisCache *RepositoryScanner::getAnalysisCache() const {
+    return analysisCache.get();
+}
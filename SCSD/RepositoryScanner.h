@@ -0,0 +1,150 @@
+/**
+ * @file RepositoryScanner.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Walks A Directory Tree And Parses Its Source Files In Parallel Into One Function Index
+ */
+
+#ifndef REPOSITORY_SCANNER_H
+#define REPOSITORY_SCANNER_H
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+#include "AnalysisCache.h"
+#include "FunctionExtrapolation.h"
+
+using namespace std;
+
+const set<string> sourceFileExtensions = {".c", ".cc", ".cpp", ".cxx", ".h", ".hh", ".hpp", ".hxx"};
+
+/**
+ * @class RepositoryScanner
+ * @details Collects Source Files Under A Root Directory, Parses Each On A Worker Pool, Merges Into A Global Index
+ */
+class RepositoryScanner {
+private:
+    // Source Files To Scan, Sorted
+    vector<string> sourcePaths = {};
+    // Number of Worker Threads
+    unsigned int numOfThreads = 1;
+    // Files That Could Not Be Read
+    int numOfFailedFiles = 0;
+    // Per-File Analysis Cache, Null When Disabled
+    unique_ptr<AnalysisCache> analysisCache = nullptr;
+    // Lex Files Loaded From The Cache, Whose Entries Hold No Lexical Tokens
+    bool lexCacheHits = false;
+    // Phase Timers And Counters Shared By The Workers, Null When Disabled
+    AnalysisStatistics *analysisStatistics = nullptr;
+
+    /**
+     * parseSourceFile() Parse One File, From The Cache When Its Contents Are Unchanged
+     *
+     * @param sourcePath String
+     * @param fileSource MappedSource, Reused Between Files By One Worker
+     * @return unique_ptr<FunctionExtrapolation>, Null When The File Cannot Be Read
+     */
+    unique_ptr<FunctionExtrapolation> parseSourceFile(const string &sourcePath, MappedSource &fileSource);
+
+public:
+    /**
+     * RepositoryScanner() Constructor To Create Instance of RepositoryScanner
+     *
+     * @param threads Unsigned Int, Zero Uses One Thread Per Hardware Thread
+     */
+    explicit RepositoryScanner(unsigned int threads = 0);
+
+    /**
+     * collectSourceFiles() Recursively Gather Source Files Under A Path, Skipping Hidden Directories
+     *
+     * @param rootPath String, A Directory Or A Single File
+     * @return Int Number of Files Collected
+     */
+    int collectSourceFiles(const string &rootPath);
+
+    /**
+     * enableCache() Reload Unchanged Files From A Cache Directory, Parsed Files Are Added To It
+     *
+     * @param cacheDirectory String, Created If Missing
+     * @return Boolean, False When The Directory Cannot Be Used
+     */
+    bool enableCache(const string &cacheDirectory);
+
+    /**
+     * setLexCacheHits() Whether Files Loaded From The Cache Are Still Lexed, For Reports Reading Lexical Tokens
+     *
+     * @param lexHits Boolean
+     */
+    void setLexCacheHits(bool lexHits);
+
+    /**
+     * setStatistics() Record Read And Parse Times Of Later Scans, Null Disables Them
+     *
+     * @param statistics AnalysisStatistics, Owned By The Caller
+     */
+    void setStatistics(AnalysisStatistics *statistics);
+
+    /**
+     * isSourceFile() Whether A Path Has A Source File Extension
+     *
+     * @param filePath String
+     * @return Boolean
+     */
+    static bool isSourceFile(const string &filePath);
+
+    /**
+     * parseFile() Parse One File On The Calling Thread
+     *
+     * @param sourcePath String
+     * @return unique_ptr<FunctionExtrapolation>, Null When The File Cannot Be Read
+     */
+    unique_ptr<FunctionExtrapolation> parseFile(const string &sourcePath);
+
+    /**
+     * parseFiles() Parse Every Collected File In Parallel, Kept Apart Per File
+     *
+     * @return vector<unique_ptr<FunctionExtrapolation>>, One Per getSourcePaths() Entry, Null When Unreadable
+     */
+    vector<unique_ptr<FunctionExtrapolation>> parseFiles();
+
+    /**
+     * parseFiles() Parse A Range Of The Collected Files On The Worker Pool, Failures Are Added To The Count
+     *
+     * @param firstFile size_t
+     * @param lastFile size_t, One Past The Last
+     * @return vector<unique_ptr<FunctionExtrapolation>> One Per File In The Range, Null Where Unreadable
+     */
+    vector<unique_ptr<FunctionExtrapolation>> parseFiles(size_t firstFile, size_t lastFile);
+
+    /**
+     * scanInto() Parse Every Collected File In Parallel And Merge The Results, In Path Order
+     *
+     * @param globalIndex FunctionExtrapolation
+     */
+    void scanInto(FunctionExtrapolation &globalIndex);
+
+    /**
+     * getSourcePaths() Collected Source Files
+     *
+     * @return vector<string>
+     */
+    const vector<string> &getSourcePaths() const;
+
+    /**
+     * getNumOfFailedFiles() Files That Could Not Be Read During The Last Scan
+     *
+     * @return Int
+     */
+    int getNumOfFailedFiles() const;
+
+    /**
+     * getAnalysisCache() The Cache In Use, With Its Hit And Miss Counts
+     *
+     * @return AnalysisCache Pointer, Null When Disabled
+     */
+    const AnalysisCache *getAnalysisCache() const;
+};
+
+#endif //REPOSITORY_SCANNER_H
@@ -0,0 +1,159 @@
+/**
+ * @file ScanBenchmark.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "ScanBenchmark.h"
+#include "RepositoryScanner.h"
+#include "SourceReader.h"
+
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <thread>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
+
+ScanBenchmark::ScanBenchmark(const BenchmarkSettings &benchmarkSettings) : settings(benchmarkSettings) {
+}
+
+double ScanBenchmark::measureSeconds(const function<void()> &action) {
+    auto startTime = chrono::steady_clock::now();
+    action();
+    return chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+}
+
+void ScanBenchmark::timeReports(FunctionExtrapolation &globalIndex, BenchmarkRow &benchmarkRow) const {
+    globalIndex.setDuplicateEngine(settings.duplicateEngine);
+    // The Console Text Is Still Formatted And Written, Only To Nowhere
+    BufferedWriter discardWriter(BENCH_DISCARD_PATH);
+    ConsoleSink discardSink(discardWriter);
+    auto timeReport = [&globalIndex, &discardSink](ReportType reportType) {
+        return measureSeconds([&]() {
+            globalIndex.writeReport(reportType, discardSink);
+            discardSink.finish();
+        });
+    };
+    benchmarkRow.longSeconds = timeReport(REPORT_LONG_FUNCS);
+    benchmarkRow.paramsSeconds = timeReport(REPORT_LONG_PARAMS);
+    benchmarkRow.duplicateSeconds = timeReport(REPORT_DUPLICATES);
+}
+
+int ScanBenchmark::countFoundDuplicates(FunctionExtrapolation &globalIndex,
+                                        const vector<pair<int, int>> &plantedDuplicates) {
+    const vector<FunctionExpression> &funcExpressions = globalIndex.getFunctions();
+    unordered_map<string_view, int> namedFunctions = {};
+    for (size_t i = 0; i < funcExpressions.size(); i++) {
+        string_view funcName = funcExpressions[i].funcName;
+        namedFunctions.emplace(funcName.substr(funcName.find_last_of(' ') + 1), int(i));
+    }
+
+    set<pair<int, int>> reportedPairs = {};
+    for (const pair<int, int> &duplicate: globalIndex.findDuplicatePairs()) {
+        reportedPairs.insert(duplicate);
+    }
+    int numOfFound = 0;
+    for (const pair<int, int> &planted: plantedDuplicates) {
+        auto original = namedFunctions.find(CorpusGenerator::getFunctionName(planted.first));
+        auto copy = namedFunctions.find(CorpusGenerator::getFunctionName(planted.second));
+        if (original != namedFunctions.end() && copy != namedFunctions.end() &&
+            reportedPairs.contains(minmax(original->second, copy->second))) {
+            numOfFound += 1;
+        }
+    }
+    return numOfFound;
+}
+
+void ScanBenchmark::printRows() const {
+    cout << "\n--Benchmark Results: [SECONDS]--\n"
+         << setw(10) << "Functions" << setw(9) << "Threads" << setw(10) << "Read" << setw(10) << "Parse"
+         << setw(10) << "Merge" << setw(10) << "Long" << setw(10) << "Params" << setw(12) << "Duplicates" << "\n";
+    cout << fixed << setprecision(3);
+    for (const BenchmarkRow &benchmarkRow: benchmarkRows) {
+        cout << setw(10) << benchmarkRow.numOfFunctions << setw(9) << benchmarkRow.threads;
+        if (benchmarkRow.readSeconds < 0.0) {
+            cout << setw(10) << "-";
+        } else {
+            cout << setw(10) << benchmarkRow.readSeconds;
+        }
+        cout << setw(10) << benchmarkRow.parseSeconds << setw(10) << benchmarkRow.mergeSeconds << setw(10)
+             << benchmarkRow.longSeconds << setw(10) << benchmarkRow.paramsSeconds << setw(12)
+             << benchmarkRow.duplicateSeconds << "\n";
+    }
+    cout << defaultfloat;
+}
+
+bool ScanBenchmark::run() {
+    bool allFound = true;
+    for (int numOfFunctions = BENCH_MIN_FUNCTIONS; numOfFunctions <= settings.maxFunctions; numOfFunctions *= 10) {
+        CorpusSettings corpusSettings = settings.corpusSettings;
+        corpusSettings.numOfFunctions = numOfFunctions;
+        CorpusGenerator corpusGenerator(corpusSettings);
+        string corpusDirectory = (fs::path(settings.workDirectory) / ("n" + to_string(numOfFunctions))).string();
+        int numOfFiles = corpusGenerator.generate(corpusDirectory);
+        if (numOfFiles < 0) {
+            cout << "Cannot Write Corpus At: " << corpusDirectory << "\n";
+            return false;
+        }
+        const vector<pair<int, int>> &plantedDuplicates = corpusGenerator.getPlantedDuplicates();
+        cout << "Generated Functions: " << numOfFunctions << ", Files: " << numOfFiles
+             << ", Planted Duplicates: " << plantedDuplicates.size() << endl;
+
+        RepositoryScanner scanner(settings.threads);
+        scanner.collectSourceFiles(corpusDirectory);
+        {
+            // One Thread, Each Phase Timed Apart
+            BenchmarkRow benchmarkRow;
+            benchmarkRow.numOfFunctions = numOfFunctions;
+            benchmarkRow.readSeconds = 0.0;
+            FunctionExtrapolation globalIndex;
+            for (const string &sourcePath: scanner.getSourcePaths()) {
+                MappedSource fileSource;
+                bool isRead = false;
+                benchmarkRow.readSeconds += measureSeconds([&]() { isRead = fileSource.openFile(sourcePath); });
+                if (!isRead) {
+                    continue;
+                }
+                unique_ptr<FunctionExtrapolation> fileFunctions;
+                benchmarkRow.parseSeconds += measureSeconds([&]() {
+                    fileFunctions = make_unique<FunctionExtrapolation>(std::move(fileSource), false);
+                });
+                benchmarkRow.mergeSeconds += measureSeconds([&]() {
+                    globalIndex.mergeFunctions(std::move(*fileFunctions), sourcePath);
+                });
+            }
+            timeReports(globalIndex, benchmarkRow);
+            benchmarkRows.push_back(benchmarkRow);
+
+            int numOfFound = countFoundDuplicates(globalIndex, plantedDuplicates);
+            cout << "Parsed Functions: " << globalIndex.getNumOfFunctions() << ", Planted Duplicates Found: "
+                 << numOfFound << " / " << plantedDuplicates.size() << endl;
+            allFound = allFound && numOfFound == int(plantedDuplicates.size());
+        }
+
+        BenchmarkRow parallelRow;
+        parallelRow.numOfFunctions = numOfFunctions;
+        parallelRow.threads = settings.threads > 0 ? settings.threads : max(1u, thread::hardware_concurrency());
+        if (parallelRow.threads > 1) {
+            vector<unique_ptr<FunctionExtrapolation>> fileResults;
+            parallelRow.parseSeconds = measureSeconds([&]() { fileResults = scanner.parseFiles(); });
+            FunctionExtrapolation globalIndex;
+            parallelRow.mergeSeconds = measureSeconds([&]() {
+                for (size_t i = 0; i < fileResults.size(); i++) {
+                    if (fileResults[i] != nullptr) {
+                        globalIndex.mergeFunctions(std::move(*fileResults[i]), scanner.getSourcePaths()[i]);
+                        fileResults[i].reset();
+                    }
+                }
+            });
+            timeReports(globalIndex, parallelRow);
+            benchmarkRows.push_back(parallelRow);
+        }
+    }
+    printRows();
+    return allFound;
+}
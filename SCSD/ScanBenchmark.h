@@ -0,0 +1,112 @@
+/**
+ * @file ScanBenchmark.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Times Each Scan Phase And Report Over Generated Corpora Of Growing Size
+ */
+
+#ifndef SCAN_BENCHMARK_H
+#define SCAN_BENCHMARK_H
+
+#include <functional>
+#include <string>
+#include <vector>
+#include "CorpusGenerator.h"
+#include "FunctionExtrapolation.h"
+
+using namespace std;
+
+const int BENCH_MIN_FUNCTIONS = 1000;
+const int BENCH_MAX_FUNCTIONS = 1000000;
+const string BENCH_DISCARD_PATH = "/dev/null";
+
+/**
+ * @struct BenchmarkSettings
+ * @details What A ScanBenchmark Runs, Corpus Sizes Grow Tenfold From BENCH_MIN_FUNCTIONS To maxFunctions
+ */
+struct BenchmarkSettings {
+    // Generated Corpora Are Written Under It, One Directory Per Size
+    string workDirectory;
+    int maxFunctions = BENCH_MAX_FUNCTIONS;
+    // Threads Of The Parallel Scan, Zero Uses One Per Hardware Thread
+    unsigned int threads = 0;
+    DuplicateEngine duplicateEngine = DUP_ENGINE_PREFIX_JOIN;
+    // numOfFunctions Is Set Per Size
+    CorpusSettings corpusSettings;
+};
+
+/**
+ * @struct BenchmarkRow
+ * @details Seconds Spent In Each Phase Of One Scan, A Parallel Scan Reads And Parses Together
+ */
+struct BenchmarkRow {
+    int numOfFunctions = 0;
+    unsigned int threads = 1;
+    double readSeconds = -1.0;
+    double parseSeconds = 0.0;
+    double mergeSeconds = 0.0;
+    double longSeconds = 0.0;
+    double paramsSeconds = 0.0;
+    double duplicateSeconds = 0.0;
+};
+
+/**
+ * @class ScanBenchmark
+ * @details For Each Size, Scans The Corpus Once On One Thread (readFile, formulateFuncExpressions And Merge Timed
+ * Apart) And Once With RepositoryScanner's Workers, Times The long, params And duplicates Reports On Each Index
+ * Through A ConsoleSink Writing To BENCH_DISCARD_PATH, And Checks Every Planted Duplicate Is Reported
+ */
+class ScanBenchmark {
+private:
+    BenchmarkSettings settings;
+    vector<BenchmarkRow> benchmarkRows = {};
+
+    /**
+     * measureSeconds() Wall Clock Seconds Taken By An Action
+     *
+     * @param action function<void()>
+     * @return Double
+     */
+    static double measureSeconds(const function<void()> &action);
+
+    /**
+     * timeReports() Time The Reports Over A Scanned Index, Their Output Discarded
+     *
+     * @param globalIndex FunctionExtrapolation
+     * @param benchmarkRow BenchmarkRow
+     */
+    void timeReports(FunctionExtrapolation &globalIndex, BenchmarkRow &benchmarkRow) const;
+
+    /**
+     * countFoundDuplicates() Planted Duplicate Pairs The Index Reports
+     *
+     * @param globalIndex FunctionExtrapolation
+     * @param plantedDuplicates vector<pair<int, int>> Generated Function Indexes
+     * @return Int
+     */
+    static int countFoundDuplicates(FunctionExtrapolation &globalIndex,
+                                    const vector<pair<int, int>> &plantedDuplicates);
+
+    /**
+     * printRows() Print The Timings Gathered So Far As A Table
+     */
+    void printRows() const;
+
+public:
+    /**
+     * ScanBenchmark() Constructor To Create Instance of ScanBenchmark
+     *
+     * @param benchmarkSettings BenchmarkSettings
+     */
+    explicit ScanBenchmark(const BenchmarkSettings &benchmarkSettings);
+
+    /**
+     * run() Generate, Scan And Time Every Size, Printing Progress And The Final Table
+     *
+     * @return Boolean, False When A Corpus Cannot Be Written Or A Planted Duplicate Is Missed
+     */
+    bool run();
+};
+
+#endif //SCAN_BENCHMARK_H
@@ -9,13 +9,71 @@
 #ifndef SHARED_TRANSFORMATION_H
 #define SHARED_TRANSFORMATION_H
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <iostream>
 #include <set>
+#include <span>
+#include <string_view>
+#include <vector>
 
 using namespace std;
 
 const int DEF_START_INDEX = 0;
-const set<char> delimiterBaseMarks = {',', '=', '&', '*', '.', ';', '(', ')', '{', '}', '/'};
+const string_view delimiterBaseMarks = ",=&*.;(){}/";
+// Similarity Filters Run This Far Below Their Threshold, Rounding Can Only Add Candidates, Never Lose One
+const double FILTER_SLACK = 1e-9;
+
+/**
+ * @enum CharClass
+ * @details Character Class Bits, One Table Lookup Classifies A Byte
+ */
+enum CharClass : uint8_t {
+    CHAR_SPACE = 1, CHAR_NEWLINE = 2, CHAR_IDENTIFIER = 4, CHAR_DIGIT = 8, CHAR_PUNCTUATION = 16, CHAR_QUOTE = 32,
+    CHAR_DELIMITER = 64
+};
+
+/**
+ * makeCharClassTable() Build The CharClass Bits Of All 256 Byte Values
+ *
+ * @return array<uint8_t, 256>
+ */
+constexpr array<uint8_t, 256> makeCharClassTable() {
+    array<uint8_t, 256> classTable = {};
+    for (int c = 0; c < 256; c++) {
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v') {
+            classTable[c] = CHAR_SPACE;
+        } else if (c == '\n') {
+            classTable[c] = CHAR_NEWLINE;
+        } else if (c >= '0' && c <= '9') {
+            classTable[c] = CHAR_IDENTIFIER | CHAR_DIGIT;
+        } else if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == '$' || c >= 0x80) {
+            classTable[c] = CHAR_IDENTIFIER;
+        } else if (c == '"' || c == '\'') {
+            classTable[c] = CHAR_QUOTE;
+        } else if (c > ' ' && c < 0x7F) {
+            classTable[c] = CHAR_PUNCTUATION;
+        }
+    }
+    for (char mark: delimiterBaseMarks) {
+        classTable[uint8_t(mark)] |= CHAR_DELIMITER;
+    }
+    return classTable;
+}
+
+const array<uint8_t, 256> charClassTable = makeCharClassTable();
+
+/**
+ * hasCharClass() Validate if a character belongs to any of the given CharClass bits
+ *
+ * @param letter Char
+ * @param classBits uint8_t
+ * @return Boolean
+ */
+inline bool hasCharClass(char letter, uint8_t classBits) {
+    return (charClassTable[uint8_t(letter)] & classBits) != 0;
+}
 
 /**
  * leadingSpaceStrip() Remove leading Spaces from String
@@ -23,7 +81,7 @@ const set<char> delimiterBaseMarks = {',', '=', '&', '*', '.', ';', '(', ')', '{
  * @param wordStructure String
  * @return String
  */
-static string leadingSpaceStrip(string &wordStructure) {
+inline string leadingSpaceStrip(string &wordStructure) {
     string cleanWord = wordStructure;
     size_t leadingSpaceLoc = wordStructure.find_first_not_of(' ');
     if (leadingSpaceLoc != string::npos) {
@@ -39,7 +97,7 @@ static string leadingSpaceStrip(string &wordStructure) {
  * @param wordStructure String
  * @return String
  */
-static string trailingSpaceStrip(string &wordStructure) {
+inline string trailingSpaceStrip(string &wordStructure) {
     string cleanWord = wordStructure;
     size_t trailingSpaceLoc = wordStructure.find_last_not_of(' ');
     if (trailingSpaceLoc != string::npos) {
@@ -55,12 +113,27 @@ static string trailingSpaceStrip(string &wordStructure) {
  * @param wordStructure String
  * @return String
  */
-static string spaceStrip(string &wordStructure) {
+inline string spaceStrip(string &wordStructure) {
     string stripResult = leadingSpaceStrip(wordStructure);
     stripResult = trailingSpaceStrip(stripResult);
     return stripResult;
 }
 
+/**
+ * spaceStripView() Remove Leading And Trailing Spaces from String View, Without Copying
+ *
+ * @param wordStructure string_view
+ * @return string_view
+ */
+inline string_view spaceStripView(string_view wordStructure) {
+    size_t leadingSpaceLoc = wordStructure.find_first_not_of(' ');
+    if (leadingSpaceLoc == string_view::npos) {
+        return {};
+    }
+    size_t trailingSpaceLoc = wordStructure.find_last_not_of(' ');
+    return wordStructure.substr(leadingSpaceLoc, (trailingSpaceLoc - leadingSpaceLoc + 1));
+}
+
 /**
  * getStringSplits() Split String based on delimiter character
  *
@@ -69,36 +142,54 @@ static string spaceStrip(string &wordStructure) {
  * @param end Unsigned Integer
  * @return Vector<String>
  */
-static vector<string> getStringSplits(string word, unsigned int start, unsigned int end) {
+inline vector<string> getStringSplits(const string &word, unsigned int start, unsigned int end) {
     vector<string> returnSplits = {};
     string split;
+    end = min<unsigned int>(end, word.size());
     for (unsigned int i = start; i < end; i++) {
-        if (word.at(i) == ' ' and !split.empty()) {
+        if (word[i] == ' ' and !split.empty()) {
             returnSplits.push_back(split);
             split = "";
         } else {
-            split += word.at(i);
+            split += word[i];
         }
     }
     returnSplits.push_back(split);
     return returnSplits;
 }
 
+/**
+ * countStringSplits() Number of Splits getStringSplits() Would Return, Without Building Them
+ *
+ * @param word string_view
+ * @return Int
+ */
+inline int countStringSplits(string_view word) {
+    int numOfSplits = 1;
+    bool splitIsEmpty = true;
+    for (char letter: word) {
+        if (letter == ' ' && !splitIsEmpty) {
+            numOfSplits += 1;
+            splitIsEmpty = true;
+        } else {
+            splitIsEmpty = false;
+        }
+    }
+    return numOfSplits;
+}
+
 /**
  * doesContainPunctuation() Validate if string contains a delimiter punctuation, ignore others if specified
  *
- * @param word String
+ * @param word string_view
  * @param ignoreMarks set<char>
  * @return Boolean
  */
-static bool doesContainPunctuation(const string &word, const set<char> &ignoreMarks = {}) {
+inline bool doesContainPunctuation(string_view word, const set<char> &ignoreMarks = {}) {
     for (char letter: word) {
-        auto findPunctual = ignoreMarks.find(letter);
-        if (findPunctual == ignoreMarks.end()) {
-            findPunctual = delimiterBaseMarks.find(letter);
-            if (findPunctual != delimiterBaseMarks.end()) {
-                return true;
-            }
+        // Delimiters Are Rare, The Ignore Set Is Only Consulted For Them
+        if (hasCharClass(letter, CHAR_DELIMITER) && !ignoreMarks.contains(letter)) {
+            return true;
         }
     }
     return false;
@@ -110,7 +201,7 @@ static bool doesContainPunctuation(const string &word, const set<char> &ignoreMa
  * @param fragment2  vector<string>
  * @return Double
  */
-static double getJaccardSimilarIndex(const vector<string> &fragment1, const vector<string> &fragment2) {
+inline double getJaccardSimilarIndex(const vector<string> &fragment1, const vector<string> &fragment2) {
     set<string> unionCharacters = {};
     set<string> intersectionCharacters = {};
     for (const string &frag: fragment1) {
@@ -126,4 +217,78 @@ static double getJaccardSimilarIndex(const vector<string> &fragment1, const vect
     return double(intersectionCharacters.size()) / double(unionCharacters.size());
 }
 
+/**
+ * hashBytes() 64-Bit Hash Of A Byte Range, Eight Bytes Per Step, Stable Across Runs And Builds
+ *
+ * @param bytes string_view
+ * @return uint64_t
+ */
+inline uint64_t hashBytes(string_view bytes) {
+    const uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+    uint64_t hash = 0xCBF29CE484222325ULL ^ (bytes.size() * multiplier);
+    size_t i = 0;
+    for (; i + 8 <= bytes.size(); i += 8) {
+        uint64_t word = 0;
+        for (size_t b = 0; b < 8; b++) {
+            word |= uint64_t(uint8_t(bytes[i + b])) << (8 * b);
+        }
+        hash = (hash ^ word) * multiplier;
+        hash ^= hash >> 29;
+    }
+    uint64_t tail = 0;
+    for (size_t b = 0; i + b < bytes.size(); b++) {
+        tail |= uint64_t(uint8_t(bytes[i + b])) << (8 * b);
+    }
+    hash = (hash ^ tail) * multiplier;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 31);
+}
+
+/**
+ * toTokenSet() Sort And Remove Repeated Token Ids
+ *
+ * @param tokenIds vector<uint32_t>
+ */
+inline void toTokenSet(vector<uint32_t> &tokenIds) {
+    sort(tokenIds.begin(), tokenIds.end());
+    tokenIds.erase(unique(tokenIds.begin(), tokenIds.end()), tokenIds.end());
+}
+
+/**
+ * getJaccardSimilarIndex() Get Similarity Index Between Two Token Sets, By Merging, Without Allocating
+ * @param tokenSet1 span<const uint32_t>, Sorted Without Repeats
+ * @param tokenSet2 span<const uint32_t>, Sorted Without Repeats
+ * @return Double
+ */
+inline double getJaccardSimilarIndex(span<const uint32_t> tokenSet1, span<const uint32_t> tokenSet2) {
+    size_t i = 0, j = 0, sharedTokens = 0;
+    while (i < tokenSet1.size() && j < tokenSet2.size()) {
+        uint32_t token1 = tokenSet1[i], token2 = tokenSet2[j];
+        sharedTokens += (token1 == token2);
+        i += (token1 <= token2);
+        j += (token2 <= token1);
+    }
+    size_t unionTokens = tokenSet1.size() + tokenSet2.size() - sharedTokens;
+    return double(sharedTokens) / double(unionTokens);
+}
+
+/**
+ * getJaccardSimilarIndex() Get Similarity Index Between Two Sets Of Token Hashes, By Merging, Without Allocating
+ * @param hashSet1 span<const uint64_t>, Sorted Without Repeats
+ * @param hashSet2 span<const uint64_t>, Sorted Without Repeats
+ * @return Double
+ */
+inline double getJaccardSimilarIndex(span<const uint64_t> hashSet1, span<const uint64_t> hashSet2) {
+    size_t i = 0, j = 0, sharedTokens = 0;
+    while (i < hashSet1.size() && j < hashSet2.size()) {
+        uint64_t hash1 = hashSet1[i], hash2 = hashSet2[j];
+        sharedTokens += (hash1 == hash2);
+        i += (hash1 <= hash2);
+        j += (hash2 <= hash1);
+    }
+    size_t unionTokens = hashSet1.size() + hashSet2.size() - sharedTokens;
+    return double(sharedTokens) / double(unionTokens);
+}
+
 #endif //SHARED_TRANSFORMATION_H
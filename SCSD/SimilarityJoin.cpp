@@ -0,0 +1,151 @@
+/**
+ * @file SimilarityJoin.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "SimilarityJoin.h"
+#include "SharedTransformation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+int SimilarityJoin::addRecord(span<const uint32_t> tokenSet) {
+    tokenRecords.emplace_back(tokenSet.begin(), tokenSet.end());
+    return int(tokenRecords.size()) - 1;
+}
+
+void SimilarityJoin::rankRecords(vector<vector<uint32_t>> &rankedRecords) const {
+    vector<uint32_t> tokenFrequency = {};
+    for (const vector<uint32_t> &record: tokenRecords) {
+        for (uint32_t tokenId: record) {
+            if (tokenId >= tokenFrequency.size()) {
+                tokenFrequency.resize(tokenId + 1, 0);
+            }
+            tokenFrequency[tokenId] += 1;
+        }
+    }
+
+    vector<uint32_t> byFrequency(tokenFrequency.size());
+    iota(byFrequency.begin(), byFrequency.end(), 0);
+    stable_sort(byFrequency.begin(), byFrequency.end(), [&tokenFrequency](uint32_t a, uint32_t b) {
+        return tokenFrequency[a] < tokenFrequency[b];
+    });
+    vector<uint32_t> tokenRank(tokenFrequency.size());
+    for (uint32_t rank = 0; rank < byFrequency.size(); rank++) {
+        tokenRank[byFrequency[rank]] = rank;
+    }
+
+    rankedRecords = tokenRecords;
+    for (vector<uint32_t> &record: rankedRecords) {
+        for (uint32_t &tokenId: record) {
+            tokenId = tokenRank[tokenId];
+        }
+        sort(record.begin(), record.end());
+    }
+}
+
+vector<pair<int, int>> SimilarityJoin::findSimilarPairs(double threshold, ConcurrentUnionFind *cloneClasses) {
+    vector<vector<uint32_t>> records = {};
+    rankRecords(records);
+    int numOfRecords = int(records.size());
+    numOfCandidates = 0;
+    numOfVerified = 0;
+
+    // Filters Run Slightly Below The Threshold, Rounding Can Only Add Candidates, Never Lose One
+    double filterThreshold = max(0.0, threshold - FILTER_SLACK);
+    double indexThreshold = 2.0 * filterThreshold / (1.0 + filterThreshold);
+
+    // Shortest Records First, So Every Indexed Record Is No Longer Than The Probing One
+    vector<int> sizeOrder(numOfRecords);
+    iota(sizeOrder.begin(), sizeOrder.end(), 0);
+    stable_sort(sizeOrder.begin(), sizeOrder.end(), [&records](int a, int b) {
+        return records[a].size() < records[b].size();
+    });
+
+    uint32_t numOfTokens = 0;
+    for (const vector<uint32_t> &record: records) {
+        if (!record.empty()) {
+            numOfTokens = max(numOfTokens, record.back() + 1);
+        }
+    }
+    vector<vector<pair<int, int>>> prefixIndex(numOfTokens);
+    vector<int> overlaps(numOfRecords, 0);
+    vector<int> touched = {};
+    vector<pair<int, int>> similarPairs = {};
+
+    for (int x: sizeOrder) {
+        const vector<uint32_t> &probe = records[x];
+        int probeSize = int(probe.size());
+        if (probeSize == 0) {
+            continue;
+        }
+
+        if (threshold <= 0.0) {
+            // Every Pair Qualifies, Disjoint Ones Included, Prefixes Prove Nothing
+            for (int y: sizeOrder) {
+                if (y == x) {
+                    break;
+                }
+                if (!records[y].empty()) {
+                    touched.push_back(y);
+                    overlaps[y] = 1;
+                }
+            }
+        } else {
+            int probePrefix = probeSize - int(ceil(filterThreshold * probeSize)) + 1;
+            probePrefix = clamp(probePrefix, 1, probeSize);
+            double minSize = filterThreshold * probeSize;
+
+            for (int i = 0; i < probePrefix; i++) {
+                for (const pair<int, int> &posting: prefixIndex[probe[i]]) {
+                    int y = posting.first, j = posting.second;
+                    int candidateSize = int(records[y].size());
+                    if (candidateSize < minSize || overlaps[y] < 0) {
+                        continue;
+                    }
+                    if (overlaps[y] == 0) {
+                        touched.push_back(y);
+                    }
+                    double requiredOverlap = filterThreshold / (1.0 + filterThreshold) * (probeSize + candidateSize);
+                    int bestOverlap = overlaps[y] + min(probeSize - i, candidateSize - j);
+                    overlaps[y] = bestOverlap >= ceil(requiredOverlap) ? overlaps[y] + 1 : -1;
+                }
+            }
+        }
+
+        numOfCandidates += touched.size();
+        for (int y: touched) {
+            if (overlaps[y] > 0 && (cloneClasses == nullptr || !cloneClasses->isSameSet(x, y))) {
+                numOfVerified += 1;
+                double similarIndex = getJaccardSimilarIndex(probe, records[y]);
+                if (similarIndex >= threshold) {
+                    similarPairs.emplace_back(min(x, y), max(x, y));
+                    if (cloneClasses != nullptr) {
+                        cloneClasses->unite(x, y);
+                    }
+                }
+            }
+            overlaps[y] = 0;
+        }
+        touched.clear();
+
+        int indexPrefix = probeSize - int(ceil(indexThreshold * probeSize)) + 1;
+        indexPrefix = clamp(indexPrefix, 1, probeSize);
+        for (int i = 0; i < indexPrefix; i++) {
+            prefixIndex[probe[i]].emplace_back(x, i);
+        }
+    }
+
+    sort(similarPairs.begin(), similarPairs.end());
+    return similarPairs;
+}
+
+long long SimilarityJoin::getNumOfCandidates() const {
+    return numOfCandidates;
+}
+
+long long SimilarityJoin::getNumOfVerified() const {
+    return numOfVerified;
+}
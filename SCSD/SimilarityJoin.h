@@ -0,0 +1,74 @@
+/**
+ * @file SimilarityJoin.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Exact Jaccard Self Join Of Token Sets, Prefix, Length And Position Filtering (AllPairs / PPJoin)
+ */
+
+#ifndef SIMILARITY_JOIN_H
+#define SIMILARITY_JOIN_H
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+#include "ConcurrentUnionFind.h"
+
+using namespace std;
+
+/**
+ * @class SimilarityJoin
+ * @details Records Become Token Sets Ordered Rarest First, Only Pairs Sharing A Prefix Token Are Verified
+ */
+class SimilarityJoin {
+private:
+    // Records As Sets Of Interned Token Ids
+    vector<vector<uint32_t>> tokenRecords = {};
+    // Candidate Pairs Reached Through A Shared Prefix Token, And Those Verified, During The Last Join
+    long long numOfCandidates = 0;
+    long long numOfVerified = 0;
+
+    /**
+     * rankRecords() Replace Token Ids With Their Global Rank, Rarest Token First, Sorted
+     *
+     * @param rankedRecords vector<vector<uint32_t>>
+     */
+    void rankRecords(vector<vector<uint32_t>> &rankedRecords) const;
+
+public:
+    /**
+     * addRecord() Add One Token Set
+     *
+     * @param tokenSet span<const uint32_t>, Sorted Without Repeats
+     * @return Int Index Of The Record
+     */
+    int addRecord(span<const uint32_t> tokenSet);
+
+    /**
+     * findSimilarPairs() Pairs (i < j) With Jaccard Index At Least The Threshold, Sorted
+     *
+     * @param threshold Double
+     * @param cloneClasses ConcurrentUnionFind, When Not Null Candidates Already In One Class Are Not Verified And
+     * Similar Pairs Are United
+     * @return vector<pair<int, int>>
+     */
+    vector<pair<int, int>> findSimilarPairs(double threshold, ConcurrentUnionFind *cloneClasses = nullptr);
+
+    /**
+     * getNumOfCandidates() Pairs Sharing A Prefix Token That Passed The Length Filter During The Last Join, Those
+     * Not Verified Were Pruned By The Position Filter Or Already In One Clone Class
+     *
+     * @return Long Long
+     */
+    long long getNumOfCandidates() const;
+
+    /**
+     * getNumOfVerified() Candidate Pairs Whose Overlap Was Computed During The Last Join
+     *
+     * @return Long Long
+     */
+    long long getNumOfVerified() const;
+};
+
+#endif //SIMILARITY_JOIN_H
@@ -0,0 +1,68 @@
+/**
+ * @file SourceArena.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "SourceArena.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+SourceArena::SourceArena(SourceArena &&other) noexcept {
+    *this = std::move(other);
+}
+
+SourceArena &SourceArena::operator=(SourceArena &&other) noexcept {
+    if (this != &other) {
+        blocks = std::move(other.blocks);
+        blockCursor = other.blockCursor;
+        blockEnd = other.blockEnd;
+        numOfReserved = other.numOfReserved;
+        other.blocks.clear();
+        other.blockCursor = nullptr;
+        other.blockEnd = nullptr;
+        other.numOfReserved = 0;
+    }
+    return *this;
+}
+
+void *SourceArena::allocate(size_t size, size_t alignment) {
+    uintptr_t aligned = (uintptr_t(blockCursor) + alignment - 1) & ~uintptr_t(alignment - 1);
+    if (blockCursor == nullptr || aligned + size > uintptr_t(blockEnd)) {
+        // Blocks Grow With The Arena, Oversized Requests Get A Block Of Their Own
+        size_t blockSize = max({ARENA_BLOCK_SIZE, min(numOfReserved, ARENA_MAX_BLOCK_SIZE), size + alignment});
+        blocks.push_back(unique_ptr<char[]>(new char[blockSize]));
+        blockCursor = blocks.back().get();
+        blockEnd = blockCursor + blockSize;
+        numOfReserved += blockSize;
+        aligned = (uintptr_t(blockCursor) + alignment - 1) & ~uintptr_t(alignment - 1);
+    }
+    blockCursor = reinterpret_cast<char *>(aligned + size);
+    return reinterpret_cast<void *>(aligned);
+}
+
+string_view SourceArena::store(string_view text) {
+    return concat(text, {}, {});
+}
+
+string_view SourceArena::concat(string_view first, string_view second, string_view third) {
+    size_t totalSize = first.size() + second.size() + third.size();
+    if (totalSize == 0) {
+        return {};
+    }
+    char *joined = static_cast<char *>(allocate(totalSize, 1));
+    char *cursor = joined;
+    for (string_view piece: {first, second, third}) {
+        if (!piece.empty()) {
+            memcpy(cursor, piece.data(), piece.size());
+            cursor += piece.size();
+        }
+    }
+    return {joined, totalSize};
+}
+
+size_t SourceArena::getNumOfReserved() const {
+    return numOfReserved;
+}
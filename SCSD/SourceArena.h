@@ -0,0 +1,115 @@
+/**
+ * @file SourceArena.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Bump Allocator For Data Derived From One Source File, Freed All At Once With Its Owner
+ */
+
+#ifndef SOURCE_ARENA_H
+#define SOURCE_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+const size_t ARENA_BLOCK_SIZE = 64 * 1024;
+const size_t ARENA_MAX_BLOCK_SIZE = 16 * 1024 * 1024;
+
+/**
+ * @class SourceArena
+ * @details Hands Out Memory From Large Blocks, Moving An Arena Keeps Every Pointer It Handed Out Valid
+ */
+class SourceArena {
+private:
+    // Memory Blocks, Never Reallocated
+    vector<unique_ptr<char[]>> blocks = {};
+    // Free Space In The Newest Block
+    char *blockCursor = nullptr;
+    char *blockEnd = nullptr;
+    // Total Bytes Held In Blocks
+    size_t numOfReserved = 0;
+
+public:
+    /**
+     * SourceArena() Constructor To Create An Empty SourceArena, Blocks Are Added On Demand
+     */
+    SourceArena() = default;
+
+    SourceArena(const SourceArena &) = delete;
+
+    SourceArena &operator=(const SourceArena &) = delete;
+
+    /**
+     * SourceArena() Move Constructor, Takes Over The Blocks
+     *
+     * @param other SourceArena
+     */
+    SourceArena(SourceArena &&other) noexcept;
+
+    /**
+     * operator=() Move Assignment, Takes Over The Blocks
+     *
+     * @param other SourceArena
+     * @return SourceArena
+     */
+    SourceArena &operator=(SourceArena &&other) noexcept;
+
+    /**
+     * allocate() Uninitialized Memory, Valid Until The Arena Is Destroyed
+     *
+     * @param size Bytes
+     * @param alignment Bytes, A Power Of Two
+     * @return Void Pointer
+     */
+    void *allocate(size_t size, size_t alignment = alignof(max_align_t));
+
+    /**
+     * store() Copy Text Into The Arena
+     *
+     * @param text string_view
+     * @return string_view, Viewing The Copy
+     */
+    string_view store(string_view text);
+
+    /**
+     * concat() Join Three Pieces Of Text Into One Arena Copy
+     *
+     * @param first string_view
+     * @param second string_view
+     * @param third string_view
+     * @return string_view
+     */
+    string_view concat(string_view first, string_view second, string_view third);
+
+    /**
+     * storeArray() Copy A Range Of Trivially Copyable Values Into The Arena
+     *
+     * @param values span<const T>
+     * @return span<const T>
+     */
+    template<typename T>
+    span<const T> storeArray(span<const T> values) {
+        static_assert(is_trivially_copyable_v<T> && is_trivially_destructible_v<T>);
+        if (values.empty()) {
+            return {};
+        }
+        T *copied = static_cast<T *>(allocate(values.size_bytes(), alignof(T)));
+        uninitialized_copy(values.begin(), values.end(), copied);
+        return {copied, values.size()};
+    }
+
+    /**
+     * getNumOfReserved() Bytes Held In Blocks
+     *
+     * @return size_t
+     */
+    size_t getNumOfReserved() const;
+};
+
+#endif //SOURCE_ARENA_H
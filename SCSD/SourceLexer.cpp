@@ -0,0 +1,228 @@
+/**
+ * @file SourceLexer.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "SourceLexer.h"
+#include "SharedTransformation.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+const string_view threeCharOperators[] = {"<<=", ">>=", "...", "->*", "<=>"};
+const string_view twoCharOperators[] = {"::", "->", "++", "--", "&&", "||", "==", "!=", "<=", ">=", "<<", ">>",
+                                        "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", ".*", "##"};
+const string_view rawStringPrefixes[] = {"R", "LR", "uR", "UR", "u8R"};
+const string_view literalPrefixes[] = {"L", "u", "U", "u8"};
+
+const char *SourceLexer::skipSpaces(const char *cursor, const char *end) {
+#if defined(__SSE2__)
+    const __m128i space = _mm_set1_epi8(' '), tab = _mm_set1_epi8('\t'), carriage = _mm_set1_epi8('\r');
+    while (end - cursor >= 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cursor));
+        __m128i blank = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, space), _mm_cmpeq_epi8(block, tab)),
+                                     _mm_cmpeq_epi8(block, carriage));
+        unsigned int nonBlank = ~unsigned(_mm_movemask_epi8(blank)) & 0xFFFFu;
+        if (nonBlank != 0) {
+            cursor += __builtin_ctz(nonBlank);
+            break;
+        }
+        cursor += 16;
+    }
+#endif
+    while (cursor < end && hasCharClass(*cursor, CHAR_SPACE)) {
+        cursor++;
+    }
+    return cursor;
+}
+
+const char *SourceLexer::findAnyOf(const char *cursor, const char *end, char mark1, char mark2, char mark3) {
+#if defined(__SSE2__)
+    const __m128i first = _mm_set1_epi8(mark1), second = _mm_set1_epi8(mark2), third = _mm_set1_epi8(mark3);
+    while (end - cursor >= 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cursor));
+        __m128i found = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, first), _mm_cmpeq_epi8(block, second)),
+                                     _mm_cmpeq_epi8(block, third));
+        unsigned int foundMask = unsigned(_mm_movemask_epi8(found));
+        if (foundMask != 0) {
+            return cursor + __builtin_ctz(foundMask);
+        }
+        cursor += 16;
+    }
+#endif
+    while (cursor < end && *cursor != mark1 && *cursor != mark2 && *cursor != mark3) {
+        cursor++;
+    }
+    return cursor;
+}
+
+const char *SourceLexer::skipQuoted(const char *cursor, const char *end, char quote, int &lineNumber) {
+    while (cursor < end) {
+        const char *mark = findAnyOf(cursor, end, quote, '\\', '\n');
+        if (mark == end || *mark == '\n') {
+            return mark;
+        }
+        if (*mark == quote) {
+            return mark + 1;
+        }
+        // Escape, A Backslash Before A Line End Continues The Literal
+        const char *escaped = mark + 1;
+        if (escaped < end && *escaped == '\r' && escaped + 1 < end && escaped[1] == '\n') {
+            escaped++;
+        }
+        if (escaped < end && *escaped == '\n') {
+            lineNumber += 1;
+        }
+        cursor = min(escaped + 1, end);
+    }
+    return end;
+}
+
+const char *SourceLexer::skipRawString(const char *cursor, const char *end, int &lineNumber) {
+    const char *openParen = findAnyOf(cursor + 1, end, '(', '\n', '"');
+    if (openParen == end || *openParen != '(') {
+        return skipQuoted(cursor + 1, end, '"', lineNumber);
+    }
+    string closing = ")" + string(cursor + 1, openParen) + "\"";
+    string_view rest(openParen + 1, size_t(end - openParen - 1));
+    size_t closeAt = rest.find(closing);
+    const char *literalEnd = closeAt == string_view::npos ? end : rest.data() + closeAt + closing.size();
+    lineNumber += int(count(openParen, literalEnd, '\n'));
+    return literalEnd;
+}
+
+const char *SourceLexer::skipBlockComment(const char *cursor, const char *end, int &lineNumber) {
+    while (cursor < end) {
+        const char *mark = findAnyOf(cursor, end, '*', '\n', '\n');
+        if (mark == end) {
+            return end;
+        }
+        if (*mark == '\n') {
+            lineNumber += 1;
+        } else if (mark + 1 < end && mark[1] == '/') {
+            return mark + 2;
+        }
+        cursor = mark + 1;
+    }
+    return end;
+}
+
+const char *SourceLexer::skipLogicalLine(const char *cursor, const char *end, int &lineNumber) {
+    while (cursor < end) {
+        const char *lineEnd = static_cast<const char *>(memchr(cursor, '\n', size_t(end - cursor)));
+        if (lineEnd == nullptr) {
+            return end;
+        }
+        const char *last = lineEnd;
+        if (last > cursor && last[-1] == '\r') {
+            last--;
+        }
+        if (last == cursor || last[-1] != '\\') {
+            return lineEnd;
+        }
+        lineNumber += 1;
+        cursor = lineEnd + 1;
+    }
+    return end;
+}
+
+int SourceLexer::punctuationLength(const char *cursor, const char *end) {
+    size_t available = size_t(end - cursor);
+    if (available >= 2 && hasCharClass(cursor[1], CHAR_PUNCTUATION)) {
+        string_view ahead(cursor, min<size_t>(available, 3));
+        for (string_view op: threeCharOperators) {
+            if (ahead.starts_with(op)) {
+                return 3;
+            }
+        }
+        for (string_view op: twoCharOperators) {
+            if (ahead.starts_with(op)) {
+                return 2;
+            }
+        }
+    }
+    return 1;
+}
+
+void SourceLexer::tokenize(string_view source, vector<SourceToken> &tokens, int firstLine) {
+    const char *cursor = source.data();
+    const char *end = source.data() + source.size();
+    int lineNumber = firstLine;
+    bool atLineStart = true;
+    // Generous Guess, Real Code Has Far Fewer Tokens Than Bytes And Untouched Capacity Is Never Paged In
+    tokens.reserve(tokens.size() + source.size() / 2 + 1);
+
+    while (cursor < end) {
+        uint8_t charClass = charClassTable[uint8_t(*cursor)];
+        if (charClass & CHAR_SPACE) {
+            cursor = skipSpaces(cursor, end);
+            continue;
+        }
+        if (charClass & CHAR_NEWLINE) {
+            lineNumber += 1;
+            atLineStart = true;
+            cursor++;
+            continue;
+        }
+
+        const char *tokenStart = cursor;
+        int tokenLine = lineNumber;
+        TokenKind kind = TOKEN_PUNCTUATION;
+        char next = cursor + 1 < end ? cursor[1] : '\0';
+
+        if (*cursor == '#' && atLineStart) {
+            kind = TOKEN_PREPROCESSOR;
+            cursor = skipLogicalLine(cursor, end, lineNumber);
+        } else if (*cursor == '/' && next == '/') {
+            kind = TOKEN_COMMENT;
+            cursor = skipLogicalLine(cursor, end, lineNumber);
+        } else if (*cursor == '/' && next == '*') {
+            kind = TOKEN_COMMENT;
+            cursor = skipBlockComment(cursor + 2, end, lineNumber);
+        } else if ((charClass & CHAR_DIGIT) || (*cursor == '.' && hasCharClass(next, CHAR_DIGIT))) {
+            kind = TOKEN_NUMBER;
+            const char *exponentMarks = (*cursor == '0' && (next == 'x' || next == 'X')) ? "pP" : "eE";
+            cursor++;
+            while (cursor < end) {
+                char letter = *cursor;
+                bool exponentSign = (letter == '+' || letter == '-') && strchr(exponentMarks, cursor[-1]) != nullptr;
+                bool digitSeparator = letter == '\'' && cursor + 1 < end && hasCharClass(cursor[1], CHAR_IDENTIFIER);
+                if (!hasCharClass(letter, CHAR_IDENTIFIER) && letter != '.' && !exponentSign && !digitSeparator) {
+                    break;
+                }
+                cursor++;
+            }
+        } else if (charClass & CHAR_IDENTIFIER) {
+            kind = TOKEN_IDENTIFIER;
+            while (cursor < end && hasCharClass(*cursor, CHAR_IDENTIFIER)) {
+                cursor++;
+            }
+            // Encoding Prefixes Belong To The Literal That Follows
+            if (cursor < end && hasCharClass(*cursor, CHAR_QUOTE)) {
+                string_view prefix(tokenStart, size_t(cursor - tokenStart));
+                if (*cursor == '"' && find(begin(rawStringPrefixes), std::end(rawStringPrefixes), prefix) !=
+                                      std::end(rawStringPrefixes)) {
+                    kind = TOKEN_STRING;
+                    cursor = skipRawString(cursor, end, lineNumber);
+                } else if (find(begin(literalPrefixes), std::end(literalPrefixes), prefix) !=
+                           std::end(literalPrefixes)) {
+                    kind = *cursor == '"' ? TOKEN_STRING : TOKEN_CHARACTER;
+                    cursor = skipQuoted(cursor + 1, end, *cursor, lineNumber);
+                }
+            }
+        } else if (charClass & CHAR_QUOTE) {
+            kind = *cursor == '"' ? TOKEN_STRING : TOKEN_CHARACTER;
+            cursor = skipQuoted(cursor + 1, end, *cursor, lineNumber);
+        } else {
+            cursor += punctuationLength(cursor, end);
+        }
+
+        atLineStart = false;
+        tokens.push_back({string_view(tokenStart, size_t(cursor - tokenStart)), tokenLine, kind});
+    }
+}
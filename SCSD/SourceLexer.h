@@ -0,0 +1,125 @@
+/**
+ * @file SourceLexer.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Table Driven C/C++ Lexer, Whitespace And Delimiter Runs Scanned 16 Bytes At A Time Where SSE2 Exists
+ */
+
+#ifndef SOURCE_LEXER_H
+#define SOURCE_LEXER_H
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @enum TokenKind
+ * @details Lexical Category Of A SourceToken
+ */
+enum TokenKind : uint8_t {
+    TOKEN_IDENTIFIER, TOKEN_NUMBER, TOKEN_STRING, TOKEN_CHARACTER, TOKEN_PUNCTUATION, TOKEN_COMMENT,
+    TOKEN_PREPROCESSOR
+};
+
+/**
+ * @struct SourceToken
+ * @details One Token, Viewing Into Its Source Buffer, With The Line It Starts On
+ */
+struct SourceToken {
+    string_view text;
+    int lineNumber = 0;
+    TokenKind kind = TOKEN_PUNCTUATION;
+};
+
+/**
+ * @class SourceLexer
+ * @details Splits Source Text Into Identifiers, Literals, Punctuation, Comments And Preprocessor Lines
+ */
+class SourceLexer {
+private:
+    /**
+     * skipSpaces() First Character That Is Not A Space, Tab Or Carriage Return
+     *
+     * @param cursor Char Pointer
+     * @param end Char Pointer
+     * @return Char Pointer
+     */
+    static const char *skipSpaces(const char *cursor, const char *end);
+
+    /**
+     * findAnyOf() First Occurrence Of Any Of Three Characters, Or end
+     *
+     * @param cursor Char Pointer
+     * @param end Char Pointer
+     * @param mark1 Char
+     * @param mark2 Char
+     * @param mark3 Char
+     * @return Char Pointer
+     */
+    static const char *findAnyOf(const char *cursor, const char *end, char mark1, char mark2, char mark3);
+
+    /**
+     * skipQuoted() End Of A String Or Character Literal, Stops At An Unescaped Line End If Unterminated
+     *
+     * @param cursor Char Pointer, Just Past The Opening Quote
+     * @param end Char Pointer
+     * @param quote Char
+     * @param lineNumber Int, Advanced Over Escaped Line Ends
+     * @return Char Pointer
+     */
+    static const char *skipQuoted(const char *cursor, const char *end, char quote, int &lineNumber);
+
+    /**
+     * skipRawString() End Of A Raw String Literal R"delim( ... )delim"
+     *
+     * @param cursor Char Pointer, At The Opening Quote
+     * @param end Char Pointer
+     * @param lineNumber Int, Advanced Over Line Ends
+     * @return Char Pointer
+     */
+    static const char *skipRawString(const char *cursor, const char *end, int &lineNumber);
+
+    /**
+     * skipBlockComment() End Of A Block Comment
+     *
+     * @param cursor Char Pointer, Just Past The Opening Slash Star
+     * @param end Char Pointer
+     * @param lineNumber Int, Advanced Over Line Ends
+     * @return Char Pointer
+     */
+    static const char *skipBlockComment(const char *cursor, const char *end, int &lineNumber);
+
+    /**
+     * skipLogicalLine() End Of A Line, Following Backslash Continuations
+     *
+     * @param cursor Char Pointer
+     * @param end Char Pointer
+     * @param lineNumber Int, Advanced Over Continued Line Ends
+     * @return Char Pointer
+     */
+    static const char *skipLogicalLine(const char *cursor, const char *end, int &lineNumber);
+
+    /**
+     * punctuationLength() Length Of The Longest Operator Starting At cursor
+     *
+     * @param cursor Char Pointer
+     * @param end Char Pointer
+     * @return Int
+     */
+    static int punctuationLength(const char *cursor, const char *end);
+
+public:
+    /**
+     * tokenize() Append The Tokens Of source, Whitespace Dropped
+     *
+     * @param source string_view
+     * @param tokens vector<SourceToken>
+     * @param firstLine Int, Line Number Of The First Character
+     */
+    static void tokenize(string_view source, vector<SourceToken> &tokens, int firstLine = 1);
+};
+
+#endif //SOURCE_LEXER_H
@@ -0,0 +1,147 @@
+/**
+ * @file SourceReader.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "SourceReader.h"
+#include "SharedTransformation.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedSource::MappedSource(MappedSource &&other) noexcept {
+    *this = std::move(other);
+}
+
+MappedSource &MappedSource::operator=(MappedSource &&other) noexcept {
+    if (this != &other) {
+        release();
+        mappedData = other.mappedData;
+        mappedSize = other.mappedSize;
+        readData = std::move(other.readData);
+        sourceLines = std::move(other.sourceLines);
+        other.mappedData = nullptr;
+        other.mappedSize = 0;
+        other.sourceLines.clear();
+    }
+    return *this;
+}
+
+bool MappedSource::openFile(const string &filePath, bool splitIntoLines) {
+    release();
+
+    int fileDescriptor = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0) {
+        return false;
+    }
+
+    struct stat fileInfo{};
+    if (fstat(fileDescriptor, &fileInfo) != 0 || !S_ISREG(fileInfo.st_mode)) {
+        close(fileDescriptor);
+        return false;
+    }
+
+    if (fileInfo.st_size > 0 && size_t(fileInfo.st_size) < MAP_MIN_FILE_SIZE) {
+        size_t fileSize = size_t(fileInfo.st_size), numOfRead = 0;
+        readData = make_unique<char[]>(fileSize);
+        while (numOfRead < fileSize) {
+            ssize_t readResult = read(fileDescriptor, readData.get() + numOfRead, fileSize - numOfRead);
+            if (readResult < 0 && errno == EINTR) {
+                continue;
+            }
+            // A Failed Read Must Not Pass Off A Truncated File As Whole, End Of File Means It Shrank
+            if (readResult < 0) {
+                close(fileDescriptor);
+                readData.reset();
+                return false;
+            }
+            if (readResult == 0) {
+                break;
+            }
+            numOfRead += size_t(readResult);
+        }
+        mappedData = readData.get();
+        mappedSize = numOfRead;
+    } else if (fileInfo.st_size > 0) {
+        void *mapping = mmap(nullptr, size_t(fileInfo.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (mapping == MAP_FAILED) {
+            close(fileDescriptor);
+            return false;
+        }
+        madvise(mapping, size_t(fileInfo.st_size), MADV_SEQUENTIAL);
+        mappedData = static_cast<const char *>(mapping);
+        mappedSize = size_t(fileInfo.st_size);
+    }
+    // The Mapping Stays Valid After The Descriptor Is Closed
+    close(fileDescriptor);
+
+    if (splitIntoLines) {
+        splitLines();
+    }
+    return true;
+}
+
+void MappedSource::indexLines() {
+    if (sourceLines.empty()) {
+        splitLines();
+    }
+}
+
+void MappedSource::splitLines() {
+    const char *cursor = mappedData;
+    const char *end = mappedData + mappedSize;
+
+    // Size The Line Index Once, Up Front
+    size_t numOfNewLines = size_t(count(cursor, end, '\n'));
+    sourceLines.reserve(numOfNewLines + 1);
+
+    int lineNumber = 0;
+    while (cursor < end) {
+        lineNumber += 1;
+        const char *newLine = static_cast<const char *>(memchr(cursor, '\n', size_t(end - cursor)));
+        const char *lineEnd = newLine != nullptr ? newLine : end;
+
+        string_view line(cursor, size_t(lineEnd - cursor));
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        line = spaceStripView(line);
+        if (!line.empty()) {
+            sourceLines.push_back({line, lineNumber});
+        }
+
+        cursor = newLine != nullptr ? newLine + 1 : end;
+    }
+}
+
+string_view MappedSource::getContents() const {
+    return {mappedData, mappedSize};
+}
+
+const vector<SourceLine> &MappedSource::getLines() const {
+    return sourceLines;
+}
+
+void MappedSource::releaseLines() {
+    vector<SourceLine>().swap(sourceLines);
+}
+
+void MappedSource::release() {
+    if (mappedData != nullptr && readData == nullptr) {
+        munmap(const_cast<char *>(mappedData), mappedSize);
+    }
+    readData.reset();
+    mappedData = nullptr;
+    mappedSize = 0;
+    sourceLines.clear();
+}
+
+MappedSource::~MappedSource() {
+    release();
+}
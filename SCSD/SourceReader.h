@@ -0,0 +1,120 @@
+/**
+ * @file SourceReader.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Memory Mapped Source File, Exposed As Stripped Line Views With Their Original Line Numbers
+ */
+
+#ifndef SOURCE_READER_H
+#define SOURCE_READER_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+// Files Below This Size Are Read Into Memory, Keeping Many Open Sources Under The Mapping Count Limit
+const size_t MAP_MIN_FILE_SIZE = 64 * 1024;
+
+/**
+ * @struct SourceLine
+ * @details A Non-Empty Line Of Code, Stripped Of Surrounding Spaces, Viewing Into Its Source Buffer
+ */
+struct SourceLine {
+    string_view text;
+    int lineNumber = 0;
+};
+
+/**
+ * @class MappedSource
+ * @details Maps A Source File Read-Only (Small Files Are Read) And Splits It Into SourceLine Views
+ */
+class MappedSource {
+private:
+    // Mapped File Contents
+    const char *mappedData = nullptr;
+    // Size Of Mapped File Contents
+    size_t mappedSize = 0;
+    // Contents Of A Small File, Read Instead Of Mapped
+    unique_ptr<char[]> readData = nullptr;
+    // Non-Empty Lines Of The File
+    vector<SourceLine> sourceLines = {};
+
+    /**
+     * splitLines() Index The Non-Empty Lines Of The Mapped Contents
+     */
+    void splitLines();
+
+    /**
+     * release() Unmap The File Contents
+     */
+    void release();
+
+public:
+    /**
+     * MappedSource() Constructor To Create An Empty MappedSource
+     */
+    MappedSource() = default;
+
+    MappedSource(const MappedSource &) = delete;
+
+    MappedSource &operator=(const MappedSource &) = delete;
+
+    /**
+     * MappedSource() Move Constructor, Takes Over The Mapping
+     *
+     * @param other MappedSource
+     */
+    MappedSource(MappedSource &&other) noexcept;
+
+    /**
+     * operator=() Move Assignment, Takes Over The Mapping
+     *
+     * @param other MappedSource
+     * @return MappedSource
+     */
+    MappedSource &operator=(MappedSource &&other) noexcept;
+
+    /**
+     * openFile() Map A File And Index Its Lines
+     *
+     * @param filePath String
+     * @param splitIntoLines Boolean, False Leaves The Line Index For indexLines()
+     * @return Boolean
+     */
+    bool openFile(const string &filePath, bool splitIntoLines = true);
+
+    /**
+     * indexLines() Index The Lines Of A File Opened Without Them
+     */
+    void indexLines();
+
+    /**
+     * getContents() Whole File Contents
+     *
+     * @return string_view
+     */
+    string_view getContents() const;
+
+    /**
+     * getLines() Non-Empty Lines With Original Line Numbers
+     *
+     * @return vector<SourceLine>
+     */
+    const vector<SourceLine> &getLines() const;
+
+    /**
+     * releaseLines() Free The Line Index, The Contents Stay Mapped
+     */
+    void releaseLines();
+
+    /**
+     * ~MappedSource() Destructor, Unmaps The File
+     */
+    ~MappedSource();
+};
+
+#endif //SOURCE_READER_H
@@ -0,0 +1,41 @@
+/**
+ * @file TokenPool.cpp
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ */
+
+#include "TokenPool.h"
+#include "SharedTransformation.h"
+
+uint32_t TokenPool::intern(string_view token) {
+    auto found = tokenIds.find(token);
+    if (found != tokenIds.end()) {
+        return found->second;
+    }
+    uint32_t tokenId = uint32_t(tokens.size());
+    tokens.emplace_back(token);
+    tokenIds.emplace(tokens.back(), tokenId);
+    tokenHashes.push_back(hashBytes(token));
+    return tokenId;
+}
+
+bool TokenPool::find(string_view token, uint32_t &tokenId) const {
+    auto found = tokenIds.find(token);
+    if (found == tokenIds.end()) {
+        return false;
+    }
+    tokenId = found->second;
+    return true;
+}
+
+const string &TokenPool::getToken(uint32_t tokenId) const {
+    return tokens.at(tokenId);
+}
+
+uint64_t TokenPool::getTokenHash(uint32_t tokenId) const {
+    return tokenHashes.at(tokenId);
+}
+
+uint32_t TokenPool::getNumOfTokens() const {
+    return uint32_t(tokens.size());
+}
@@ -0,0 +1,76 @@
+/**
+ * @file TokenPool.h
+ * @author Edwin Kaburu
+ * @date 10/18/2026
+ *
+ * Interned Token Strings, Each Distinct Token Stored Once And Named By A Dense uint32_t Id
+ */
+
+#ifndef TOKEN_POOL_H
+#define TOKEN_POOL_H
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class TokenPool
+ * @details Maps Tokens To Ids In First Seen Order, Lookups By string_view Do Not Allocate
+ */
+class TokenPool {
+private:
+    // Token Storage, A deque Keeps Every Stored Token At A Stable Address
+    deque<string> tokens = {};
+    // Token View Into tokens -> Id
+    unordered_map<string_view, uint32_t> tokenIds = {};
+    // Content Hash Of Each Token, Indexed By Id, The Same In Every Run
+    vector<uint64_t> tokenHashes = {};
+
+public:
+    /**
+     * intern() Id Of A Token, Adding It To The Pool When New
+     *
+     * @param token string_view
+     * @return uint32_t
+     */
+    uint32_t intern(string_view token);
+
+    /**
+     * find() Id Of A Token Already In The Pool, Without Adding It
+     *
+     * @param token string_view
+     * @param tokenId uint32_t
+     * @return Boolean, False When The Token Was Never Interned
+     */
+    bool find(string_view token, uint32_t &tokenId) const;
+
+    /**
+     * getToken() Token Named By An Id
+     *
+     * @param tokenId uint32_t
+     * @return String
+     */
+    const string &getToken(uint32_t tokenId) const;
+
+    /**
+     * getTokenHash() Content Hash Of The Token Named By An Id, Unlike The Id It Does Not Depend On Intern Order
+     *
+     * @param tokenId uint32_t
+     * @return uint64_t
+     */
+    uint64_t getTokenHash(uint32_t tokenId) const;
+
+    /**
+     * getNumOfTokens() Number Of Distinct Tokens
+     *
+     * @return uint32_t
+     */
+    uint32_t getNumOfTokens() const;
+};
+
+#endif //TOKEN_POOL_H
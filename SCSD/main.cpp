@@ -7,35 +7,34 @@
 #include <iostream>
 #include <limits>
 #include <vector>
-#include <fstream>
+#include <sstream>
+#include "AnalysisServer.h"
+#include "CorpusGenerator.h"
+#include "ExternalScan.h"
+#include "IndexArchive.h"
+#include "ReportSink.h"
 #include "FunctionExtrapolation.h"
+#include "RepositoryScanner.h"
+#include "ScanBenchmark.h"
+#include "SourceReader.h"
 
 using namespace std;
 
 enum SmellCommands {
-    DISP_FUNCS, DISP_LONG_FUNCS, DISP_LONG_PARAMS, DISP_DUP_FUNCS
+    // 4 Stays Exit, As Scripted Input Relies On It, Later Commands Are Numbered After It
+    DISP_FUNCS, DISP_LONG_FUNCS, DISP_LONG_PARAMS, DISP_DUP_FUNCS, DISP_CLONE_FRAGMENTS = 5, DISP_COMPLEX_FUNCS
 };
 
 /**
- * readFile() File Main Source File and Save Data To String Vector
+ * readFile() Map Main Source File, Its Non-Empty Lines Become Views With Original Line Numbers
  *
  * @param filePath string
- * @param linesOfCodes vector<string>
+ * @param fileSource MappedSource
  * @return Boolean
  */
-bool readFile(const string &filePath, vector<string> &linesOfCodes) {
-    ifstream inputFile(filePath);
-    if (inputFile) {
+bool readFile(const string &filePath, MappedSource &fileSource) {
+    if (fileSource.openFile(filePath)) {
         cout << "File is Open\n";
-        string line;
-        while (getline(inputFile, line)) {
-            if (!line.empty()) {
-                line = spaceStrip(line);
-                linesOfCodes.push_back(line);
-            }
-        }
-
-        inputFile.close();
         return true;
     }
     cout << "File Does Not Exists\n";
@@ -50,7 +49,9 @@ void displayCommands() {
             "Enter Num: 1 -> Display Long Functions\n"
             "Enter Num: 2 -> Display Long Parameters List\n"
             "Enter Num: 3 -> Display Duplicate Functions\n"
-            "Enter Num: 4 -> Exit\n";
+            "Enter Num: 4 -> Exit\n"
+            "Enter Num: 5 -> Display Clone Fragments\n"
+            "Enter Num: 6 -> Display Complex Functions\n";
 }
 
 /**
@@ -74,17 +75,555 @@ bool userCommandsHandler(SmellCommands command, FunctionExtrapolation &functionE
         case DISP_DUP_FUNCS:
             functionExtrapolation.printDuplicateFunc();
             break;
+        case DISP_CLONE_FRAGMENTS:
+            functionExtrapolation.printCloneFragments();
+            break;
+        case DISP_COMPLEX_FUNCS:
+            functionExtrapolation.printComplexFunctions();
+            break;
         default:
             return false;
     }
     return true;
 }
 
+/**
+ * parseReportList() Map A Comma Separated Report List To SmellCommands
+ *
+ * @param reportList string, Names Out Of functions, long, params, duplicates, clones, complex
+ * @param commands vector<SmellCommands>
+ * @return Boolean
+ */
+bool parseReportList(const string &reportList, vector<SmellCommands> &commands) {
+    stringstream reportStream(reportList);
+    string reportName;
+    while (getline(reportStream, reportName, ',')) {
+        if (reportName == "functions") {
+            commands.push_back(DISP_FUNCS);
+        } else if (reportName == "long") {
+            commands.push_back(DISP_LONG_FUNCS);
+        } else if (reportName == "params") {
+            commands.push_back(DISP_LONG_PARAMS);
+        } else if (reportName == "duplicates") {
+            commands.push_back(DISP_DUP_FUNCS);
+        } else if (reportName == "clones") {
+            commands.push_back(DISP_CLONE_FRAGMENTS);
+        } else if (reportName == "complex") {
+            commands.push_back(DISP_COMPLEX_FUNCS);
+        } else {
+            cout << "Unknown Report: " << reportName << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * toReportType() Report Behind A Command
+ *
+ * @param command SmellCommands
+ * @return ReportType
+ */
+ReportType toReportType(SmellCommands command) {
+    switch (command) {
+        case DISP_FUNCS:
+            return REPORT_FUNCTIONS;
+        case DISP_LONG_FUNCS:
+            return REPORT_LONG_FUNCS;
+        case DISP_LONG_PARAMS:
+            return REPORT_LONG_PARAMS;
+        case DISP_DUP_FUNCS:
+            return REPORT_DUPLICATES;
+        case DISP_CLONE_FRAGMENTS:
+            return REPORT_CLONE_FRAGMENTS;
+        default:
+            return REPORT_COMPLEX_FUNCS;
+    }
+}
+
+/**
+ * openReportOutput() Open The Writer And Sink Reports Go To
+ *
+ * @param format String, console, jsonl Or sarif
+ * @param outputPath String, Standard Output When Empty
+ * @param reportWriter unique_ptr<BufferedWriter>
+ * @param reportSink unique_ptr<ReportSink>
+ * @return Boolean
+ */
+bool openReportOutput(const string &format, const string &outputPath, unique_ptr<BufferedWriter> &reportWriter,
+                      unique_ptr<ReportSink> &reportSink) {
+    reportWriter = outputPath.empty() ? make_unique<BufferedWriter>(stdout) : make_unique<BufferedWriter>(outputPath);
+    if (!reportWriter->isOpen()) {
+        cout << "Cannot Write Reports To: " << outputPath << "\n";
+        return false;
+    }
+    reportSink = ReportSink::create(format, *reportWriter);
+    if (reportSink == nullptr) {
+        cout << "Unknown Format: " << format << "\n";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * scanRepository() Non-Interactive Scan Of A Directory Tree, Prints The Requested Reports Over All Files
+ *
+ * @param argc Int
+ * @param argv char*[], "<path> [--threads N] [--report functions,long,params,duplicates,clones,complex]"
+ *             "[--engine prefix|pairwise|minhash] [--cache <dir>] [--stats table|json]"
+ *             "[--external <spill-dir> [--memory-cap MB]] [--format console|jsonl|sarif] [--output <file>]"
+ *             "[--save-index <file>] [--exact-pass off|whitespace|placeholders]"
+ * @return Int
+ */
+int scanRepository(int argc, char *argv[]) {
+    if (argc < 1) {
+        cout << "Missing Directory Path\n";
+        return 1;
+    }
+    string rootPath = argv[0];
+    unsigned int numOfThreads = 0;
+    string reportList = "long,params,duplicates";
+    DuplicateEngine duplicateEngine = DUP_ENGINE_PREFIX_JOIN;
+    ExactMatchMode exactMatchMode = EXACT_MATCH_OFF;
+    string cacheDirectory, statsFormat, spillDirectory, outputPath, indexPath;
+    string reportFormat = "console";
+    size_t memoryCap = EXTERNAL_DEFAULT_MEMORY_CAP;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        string option = argv[i];
+        if (option == "--threads") {
+            numOfThreads = unsigned(stoul(argv[i + 1]));
+        } else if (option == "--stats") {
+            statsFormat = argv[i + 1];
+            if (statsFormat != "table" && statsFormat != "json") {
+                cout << "Unknown Stats Format: " << statsFormat << "\n";
+                return 1;
+            }
+        } else if (option == "--report") {
+            reportList = argv[i + 1];
+        } else if (option == "--engine") {
+            string engineName = argv[i + 1];
+            if (engineName == "pairwise") {
+                duplicateEngine = DUP_ENGINE_PAIRWISE;
+            } else if (engineName == "minhash") {
+                duplicateEngine = DUP_ENGINE_MINHASH;
+            } else if (engineName != "prefix") {
+                cout << "Unknown Engine: " << engineName << "\n";
+                return 1;
+            }
+        } else if (option == "--cache") {
+            cacheDirectory = argv[i + 1];
+        } else if (option == "--external") {
+            spillDirectory = argv[i + 1];
+        } else if (option == "--memory-cap") {
+            memoryCap = size_t(stoull(argv[i + 1])) << 20;
+        } else if (option == "--format") {
+            reportFormat = argv[i + 1];
+        } else if (option == "--output") {
+            outputPath = argv[i + 1];
+        } else if (option == "--save-index") {
+            indexPath = argv[i + 1];
+        } else if (option == "--exact-pass") {
+            string modeName = argv[i + 1];
+            if (modeName == "whitespace") {
+                exactMatchMode = EXACT_MATCH_WHITESPACE;
+            } else if (modeName == "placeholders") {
+                exactMatchMode = EXACT_MATCH_PLACEHOLDERS;
+            } else if (modeName != "off") {
+                cout << "Unknown Exact Pass: " << modeName << "\n";
+                return 1;
+            }
+        }
+    }
+    if (!indexPath.empty() && !spillDirectory.empty()) {
+        cout << "An Index Cannot Be Saved In External Mode\n";
+        return 1;
+    }
+    if (exactMatchMode != EXACT_MATCH_OFF && !spillDirectory.empty()) {
+        cout << "The Exact Pass Is Not Available In External Mode\n";
+        return 1;
+    }
+
+    vector<SmellCommands> commands = {};
+    unique_ptr<BufferedWriter> reportWriter = nullptr;
+    unique_ptr<ReportSink> reportSink = nullptr;
+    if (!parseReportList(reportList, commands) ||
+        !openReportOutput(reportFormat, outputPath, reportWriter, reportSink)) {
+        return 1;
+    }
+    // Machine Readable Reports On Standard Output Keep It To Themselves
+    ostream &statusOutput = reportFormat != "console" && outputPath.empty() ? cerr : cout;
+
+    RepositoryScanner scanner(numOfThreads);
+    if (!cacheDirectory.empty() && !scanner.enableCache(cacheDirectory)) {
+        cout << "Unusable Cache Directory: " << cacheDirectory << "\n";
+        return 1;
+    }
+    scanner.setLexCacheHits(find(commands.begin(), commands.end(), DISP_CLONE_FRAGMENTS) != commands.end());
+    int numOfFiles = scanner.collectSourceFiles(rootPath);
+
+    // Only Allocated When Asked For, Every Timer And Counter Is Skipped Otherwise
+    unique_ptr<AnalysisStatistics> analysisStatistics = nullptr;
+    if (!statsFormat.empty()) {
+        analysisStatistics = make_unique<AnalysisStatistics>();
+    }
+    scanner.setStatistics(analysisStatistics.get());
+
+    // Bounded Memory: Functions Are Spilled As Each Window Of Files Is Parsed, Never Merged Into One Index
+    unique_ptr<ExternalScan> externalScan = nullptr;
+    if (!spillDirectory.empty()) {
+        externalScan = make_unique<ExternalScan>(scanner, spillDirectory, memoryCap);
+        if (!externalScan->isUsable()) {
+            cout << "Unusable Spill Directory: " << spillDirectory << "\n";
+            return 1;
+        }
+        externalScan->setStatistics(analysisStatistics.get());
+        if (!externalScan->scanFiles()) {
+            cout << "Cannot Write To Spill Directory: " << spillDirectory << "\n";
+            return 1;
+        }
+    }
+
+    FunctionExtrapolation globalIndex;
+    globalIndex.setDuplicateEngine(duplicateEngine);
+    globalIndex.setExactMatchMode(exactMatchMode);
+    globalIndex.setNumOfThreads(numOfThreads);
+    globalIndex.setStatistics(analysisStatistics.get());
+    if (externalScan == nullptr) {
+        scanner.scanInto(globalIndex);
+    }
+    int numOfFunctions = externalScan != nullptr ? externalScan->getNumOfFunctions() : globalIndex.getNumOfFunctions();
+    statusOutput << "Scanned Files: " << numOfFiles << ", Unreadable: " << scanner.getNumOfFailedFiles()
+         << ", Functions: " << numOfFunctions << "\n";
+    if (scanner.getAnalysisCache() != nullptr) {
+        statusOutput << "Cache Hits: " << scanner.getAnalysisCache()->getNumOfHits()
+             << ", Misses: " << scanner.getAnalysisCache()->getNumOfMisses() << "\n";
+    }
+
+    for (SmellCommands command: commands) {
+        ReportType reportType = toReportType(command);
+        if (externalScan == nullptr) {
+            globalIndex.writeReport(reportType, *reportSink);
+        } else if (!externalScan->writeReport(reportType, *reportSink)) {
+            reportWriter->flush();
+            if (externalScan->hasSpillFailed()) {
+                statusOutput << "Cannot Write To Spill Directory: " << spillDirectory << "\n";
+                return 1;
+            }
+            statusOutput << "Report Not Available In External Mode: " << ReportSink::getReportName(reportType) << "\n";
+        }
+    }
+    if (!reportSink->finish()) {
+        statusOutput << "Cannot Write Reports To: " << (outputPath.empty() ? "Standard Output" : outputPath) << "\n";
+        return 1;
+    }
+    if (!indexPath.empty()) {
+        globalIndex.internFunctionTokens();
+        uint64_t indexSize = IndexArchive::saveIndex(globalIndex, indexPath);
+        if (indexSize == 0) {
+            statusOutput << "Cannot Write Index To: " << indexPath << "\n";
+            return 1;
+        }
+        statusOutput << "Index Written: " << indexPath << ", Bytes: " << indexSize << "\n";
+    }
+    if (statsFormat == "table") {
+        analysisStatistics->printSummary();
+    } else if (statsFormat == "json") {
+        statusOutput << analysisStatistics->toJson() << "\n";
+    }
+    return 0;
+}
+
+/**
+ * analyzeFile() Non-Interactive Analysis Of One File, Prints The Requested Reports Without Prompting
+ *
+ * @param argc Int
+ * @param argv char*[], "<file> [--report functions,long,params,duplicates,clones,complex]"
+ *             "[--format console|jsonl|sarif] [--output <file>] [--threads N]"
+ * @return Int
+ */
+int analyzeFile(int argc, char *argv[]) {
+    if (argc < 1) {
+        cout << "Missing File Path\n";
+        return 1;
+    }
+    string reportList = "long,params,duplicates";
+    string reportFormat = "console", outputPath;
+    unsigned int numOfThreads = 1;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        string option = argv[i];
+        if (option == "--threads") {
+            numOfThreads = unsigned(stoul(argv[i + 1]));
+        } else if (option == "--report") {
+            reportList = argv[i + 1];
+        } else if (option == "--format") {
+            reportFormat = argv[i + 1];
+        } else if (option == "--output") {
+            outputPath = argv[i + 1];
+        }
+    }
+
+    vector<SmellCommands> commands = {};
+    unique_ptr<BufferedWriter> reportWriter = nullptr;
+    unique_ptr<ReportSink> reportSink = nullptr;
+    if (!parseReportList(reportList, commands) ||
+        !openReportOutput(reportFormat, outputPath, reportWriter, reportSink)) {
+        return 1;
+    }
+    MappedSource fileSource;
+    if (!fileSource.openFile(argv[0])) {
+        cerr << "File Does Not Exists\n";
+        return 1;
+    }
+
+    FunctionExtrapolation functionExtrapolation(std::move(fileSource), false, nullptr, numOfThreads);
+    for (SmellCommands command: commands) {
+        functionExtrapolation.writeReport(toReportType(command), *reportSink);
+    }
+    return reportSink->finish() ? 0 : 1;
+}
+
+/**
+ * lookupIndex() Open An Index Saved By --scan --save-index And Print The Functions With A Name, With Their Tokens,
+ * Reading Only The Blocks They Need
+ *
+ * @param argc Int
+ * @param argv char*[], "<index-file> [--lookup <function>]"
+ * @return Int
+ */
+int lookupIndex(int argc, char *argv[]) {
+    if (argc < 1) {
+        cout << "Missing Index Path\n";
+        return 1;
+    }
+    string lookupName;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (string(argv[i]) == "--lookup") {
+            lookupName = argv[i + 1];
+        }
+    }
+
+    IndexArchive indexArchive;
+    if (!indexArchive.open(argv[0])) {
+        cout << "Not A Usable Index: " << argv[0] << "\n";
+        return 1;
+    }
+    cout << "Indexed Functions: " << indexArchive.getNumOfFunctions() << ", Blocks: "
+         << indexArchive.getNumOfBlocks() << ", Bytes: " << indexArchive.getIndexSize() << "\n";
+
+    if (!lookupName.empty()) {
+        vector<int> foundFunctions = {};
+        if (!indexArchive.findFunctions(lookupName, foundFunctions)) {
+            cout << "Damaged Index: " << argv[0] << "\n";
+            return 1;
+        }
+        cout << "Found Functions: " << foundFunctions.size() << "\n";
+        ArchivedFunction archivedFunction;
+        string token;
+        for (int function: foundFunctions) {
+            if (!indexArchive.readFunction(function, archivedFunction, true)) {
+                cout << "Damaged Index: " << argv[0] << "\n";
+                return 1;
+            }
+            cout << "\t" << archivedFunction.funcName << archivedFunction.funcParams;
+            if (!archivedFunction.filePath.empty()) {
+                cout << " (" << archivedFunction.filePath << ":" << archivedFunction.stLine << ")";
+            }
+            const MetricsRow &metrics = archivedFunction.metrics;
+            cout << "\n\t\tLines: " << archivedFunction.stLine << "-" << archivedFunction.endLine
+                 << ", Params: " << metrics[METRIC_PARAMS] << ", Nesting: " << metrics[METRIC_NESTING]
+                 << ", Cyclomatic: " << metrics[METRIC_CYCLOMATIC] << ", Tokens: " << metrics[METRIC_TOKENS]
+                 << "\n\t\tToken Stream:";
+            for (size_t t = 0; t < archivedFunction.tokenStream.size(); t++) {
+                if (!indexArchive.getToken(archivedFunction.tokenStream[t], token)) {
+                    cout << "\nDamaged Index: " << argv[0] << "\n";
+                    return 1;
+                }
+                cout << (t == 0 ? " " : " | ") << token;
+            }
+            cout << "\n\t\tDistinct Tokens: " << archivedFunction.tokenSet.size() << "\n";
+        }
+    }
+    cout << "Blocks Decoded: " << indexArchive.getNumOfBlocksRead() << " Of " << indexArchive.getNumOfBlocks()
+         << ", Bytes Read: " << indexArchive.getNumOfBytesRead() << " Of " << indexArchive.getIndexSize() << "\n";
+    return 0;
+}
+
+/**
+ * serveRepository() Index A Directory Tree Once, Then Answer Queries On A Unix Socket Until Shut Down
+ *
+ * @param argc Int
+ * @param argv char*[], "<path> --socket <file> [--threads N] [--cache <dir>]"
+ * @return Int
+ */
+int serveRepository(int argc, char *argv[]) {
+    if (argc < 1) {
+        cout << "Missing Directory Path\n";
+        return 1;
+    }
+    string rootPath = argv[0];
+    string socketPath, cacheDirectory;
+    unsigned int numOfThreads = 0;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        string option = argv[i];
+        if (option == "--socket") {
+            socketPath = argv[i + 1];
+        } else if (option == "--threads") {
+            numOfThreads = unsigned(stoul(argv[i + 1]));
+        } else if (option == "--cache") {
+            cacheDirectory = argv[i + 1];
+        }
+    }
+    if (socketPath.empty()) {
+        cout << "Missing Socket Path\n";
+        return 1;
+    }
+
+    AnalysisServer analysisServer(numOfThreads);
+    if (!cacheDirectory.empty() && !analysisServer.enableCache(cacheDirectory)) {
+        cout << "Unusable Cache Directory: " << cacheDirectory << "\n";
+        return 1;
+    }
+    int numOfFiles = analysisServer.indexRepository(rootPath);
+    cout << "Indexed Files: " << numOfFiles << ", Functions: " << analysisServer.getNumOfFunctions()
+         << ", Listening On: " << socketPath << endl;
+    if (!analysisServer.serve(socketPath)) {
+        cout << "Cannot Listen On: " << socketPath << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * parseCorpusOption() Apply One Corpus Shape Option
+ *
+ * @param option String, --functions, --per-file, --body-lines, --max-params, --dup-rate Or --seed
+ * @param value String
+ * @param corpusSettings CorpusSettings
+ * @return Boolean, False When The Option Is Not A Corpus Option
+ */
+bool parseCorpusOption(const string &option, const string &value, CorpusSettings &corpusSettings) {
+    if (option == "--functions") {
+        corpusSettings.numOfFunctions = stoi(value);
+    } else if (option == "--per-file") {
+        corpusSettings.funcsPerFile = stoi(value);
+    } else if (option == "--body-lines") {
+        corpusSettings.bodyLength = stoi(value);
+    } else if (option == "--max-params") {
+        corpusSettings.maxParams = stoi(value);
+    } else if (option == "--dup-rate") {
+        corpusSettings.duplicateRate = stod(value);
+    } else if (option == "--seed") {
+        corpusSettings.seed = stoull(value);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * generateCorpus() Write A Synthetic Source Corpus With Planted Duplicates
+ *
+ * @param argc Int
+ * @param argv char*[], "<directory> [--functions N] [--per-file N] [--body-lines N] [--max-params N]"
+ *             "[--dup-rate R] [--seed S]"
+ * @return Int
+ */
+int generateCorpus(int argc, char *argv[]) {
+    if (argc < 1) {
+        cout << "Missing Directory Path\n";
+        return 1;
+    }
+    CorpusSettings corpusSettings;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        parseCorpusOption(argv[i], argv[i + 1], corpusSettings);
+    }
+
+    CorpusGenerator corpusGenerator(corpusSettings);
+    int numOfFiles = corpusGenerator.generate(argv[0]);
+    if (numOfFiles < 0) {
+        cout << "Cannot Write Corpus At: " << argv[0] << "\n";
+        return 1;
+    }
+    cout << "Generated Functions: " << corpusSettings.numOfFunctions << ", Files: " << numOfFiles
+         << ", Planted Duplicates: " << corpusGenerator.getPlantedDuplicates().size() << "\n";
+    for (const pair<int, int> &planted: corpusGenerator.getPlantedDuplicates()) {
+        cout << "\t" << CorpusGenerator::getFunctionName(planted.first) << " & "
+             << CorpusGenerator::getFunctionName(planted.second) << "\n";
+    }
+    return 0;
+}
+
+/**
+ * benchmarkScan() Time Scans And Reports Over Generated Corpora From 1K Functions Up
+ *
+ * @param argc Int
+ * @param argv char*[], "<work-directory> [--max-functions N] [--threads N] [--engine prefix|pairwise|minhash]"
+ *             Plus The Corpus Shape Options Of generateCorpus(), Except --functions
+ * @return Int, Non-Zero When A Planted Duplicate Is Missed
+ */
+int benchmarkScan(int argc, char *argv[]) {
+    if (argc < 1) {
+        cout << "Missing Directory Path\n";
+        return 1;
+    }
+    BenchmarkSettings benchmarkSettings;
+    benchmarkSettings.workDirectory = argv[0];
+    for (int i = 1; i + 1 < argc; i += 2) {
+        string option = argv[i];
+        if (option == "--max-functions") {
+            benchmarkSettings.maxFunctions = stoi(argv[i + 1]);
+        } else if (option == "--threads") {
+            benchmarkSettings.threads = unsigned(stoul(argv[i + 1]));
+        } else if (option == "--engine") {
+            string engineName = argv[i + 1];
+            if (engineName == "pairwise") {
+                benchmarkSettings.duplicateEngine = DUP_ENGINE_PAIRWISE;
+            } else if (engineName == "minhash") {
+                benchmarkSettings.duplicateEngine = DUP_ENGINE_MINHASH;
+            } else if (engineName != "prefix") {
+                cout << "Unknown Engine: " << engineName << "\n";
+                return 1;
+            }
+        } else {
+            parseCorpusOption(option, argv[i + 1], benchmarkSettings.corpusSettings);
+        }
+    }
+
+    ScanBenchmark scanBenchmark(benchmarkSettings);
+    return scanBenchmark.run() ? 0 : 1;
+}
+
 /**
  * main() Main Execution
+ *
+ * @param argc Int
+ * @param argv char*[], "--scan <path> ..." Runs Non-Interactively, "--serve <path> ..." Runs As A Server,
+ *             "--file <path> ..." Reports On One File Without Prompting,
+ *             "--index <file> ..." Looks Functions Up In A Saved Index,
+ *             "--generate <dir> ..." Writes A Synthetic Corpus, "--bench <dir> ..." Benchmarks Scans,
+ *             Otherwise Prompts For One File
  * @return Int
  */
-int main() {
+int main(int argc, char *argv[]) {
+    if (argc > 1 && string(argv[1]) == "--scan") {
+        return scanRepository(argc - 2, argv + 2);
+    }
+    if (argc > 1 && string(argv[1]) == "--file") {
+        return analyzeFile(argc - 2, argv + 2);
+    }
+    if (argc > 1 && string(argv[1]) == "--index") {
+        return lookupIndex(argc - 2, argv + 2);
+    }
+    if (argc > 1 && string(argv[1]) == "--serve") {
+        return serveRepository(argc - 2, argv + 2);
+    }
+    if (argc > 1 && string(argv[1]) == "--generate") {
+        return generateCorpus(argc - 2, argv + 2);
+    }
+    if (argc > 1 && string(argv[1]) == "--bench") {
+        return benchmarkScan(argc - 2, argv + 2);
+    }
+
     string filePath;
 
     cout << "Enter Source File Path Location:\n";
@@ -92,8 +631,8 @@ int main() {
 
     cout << "Attempt To Read File At: " << filePath << "\n";
 
-    vector<string> fileSourceCode = {};
-    bool readFileStatus = readFile(filePath, fileSourceCode);
+    MappedSource fileSource;
+    bool readFileStatus = readFile(filePath, fileSource);
 
     if (readFileStatus) {
 
@@ -102,7 +641,7 @@ int main() {
         int userCommands;
 
         cout << "Read File Success\n";
-        FunctionExtrapolation functionExtrapolation(fileSourceCode);
+        FunctionExtrapolation functionExtrapolation(std::move(fileSource));
 
         while (contListening) {
             if (actionCompleted) {